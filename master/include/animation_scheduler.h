@@ -0,0 +1,52 @@
+#ifndef ANIMATION_SCHEDULER_H
+#define ANIMATION_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Maximum number of steps of a single animation
+#define ANIMATION_MAX_STEPS 32
+
+typedef void (*t_step_action)(int arg);
+
+typedef struct animation_step
+{
+  unsigned long at;       // ms from the start of the animation
+  t_step_action action;
+  int arg;
+  bool (*ready)();        // optional, the step also runs as soon as it returns true
+} t_animation_step;
+
+/**
+ * Cooperative animation scheduler. An animation is a list of timed steps,
+ * animation_update() runs the ones that are due and returns right away, so
+ * the main loop keeps serving the network while an animation plays.
+ * A step with a ready condition runs early once the condition holds, the
+ * steps after it move earlier by the same amount.
+*/
+
+/**
+ * Starts an animation, the running one is cancelled.
+ * Steps due at 0 are run immediately.
+ * @param steps       steps sorted by time, they are copied
+ * @param count       number of steps (<= ANIMATION_MAX_STEPS)
+ * @param on_cancel   called if the animation is cancelled before its
+ *                    last step, can be NULL
+*/
+void animation_start(const t_animation_step *steps, int count, void (*on_cancel)());
+
+/**
+ * Runs the steps that are due, needs to be called on the main loop
+*/
+void animation_update();
+
+/**
+ * Drops the steps not run yet
+*/
+void animation_cancel();
+
+/**
+ * @return true if some steps are still waiting
+*/
+bool animation_running();
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef ANIMATIONS_H
+#define ANIMATIONS_H
+
+#include <TimeLib.h>
+
+// Transitions start at most this long before their minute, ms
+#define PREROLL_MAX_MS 45000
+
+/**
+ * Sets clock to the given time, nothing is sent if the
+ * minute did not change. The animation to the next minute starts as
+ * long before it as the animation is estimated to take, the hands
+ * settle when the minute begins.
+ * @param t       local time
+ * @param since   millis() when t began
+*/
+void set_time(time_t t, unsigned long since);
+
+/**
+ * Sets clock time using lazy animation, animations are built-in
+ * timelines played by animation_update()
+*/
+void set_lazy();
+
+/**
+ * Sets clock time using fun animation
+*/
+void set_fun();
+
+/**
+ * Sets clock time using waves animation
+*/
+void set_waves();
+
+/**
+ * Sets clock to stop state
+*/
+void stop();
+
+/**
+ * Quickly stops the clock with fixed speed for OTA
+*/
+void shutdown();
+
+#endif
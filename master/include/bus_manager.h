@@ -0,0 +1,125 @@
+#ifndef BUS_MANAGER_H
+#define BUS_MANAGER_H
+
+#include <Arduino.h>
+#include "clock_state.h"
+
+// Attempts of a transfer before giving up, boards not present get one
+#define BUS_ATTEMPTS 3
+// Wait before the first retry, doubled by every retry up to the max, us
+#define BUS_BACKOFF_US 200
+#define BUS_BACKOFF_MAX_US 2000
+// Every address is probed again this often, ms
+#define BUS_RESCAN_INTERVAL 60000
+// Bus clocks, slowest first, Hz. The slowest is the Wire default
+#define BUS_CLOCKS {100000, 400000, 1000000}
+#define BUS_CLOCK_SLOWEST 100000
+// The bus slows down when errors exceed this share of the transfers of
+// present boards, permille, counted over at least BUS_CLOCK_WINDOW transfers
+#define BUS_CLOCK_ERROR_PERMILLE 20
+#define BUS_CLOCK_WINDOW 500
+// Longest bus_health_json() object, terminator included
+#define BUS_HEALTH_JSON_SIZE 256
+
+/**
+ * Health of an address, counters since boot
+*/
+typedef struct board_health
+{
+  bool present;             // answered its last transfer or probe
+  uint32_t transfers;       // transfers that went through
+  uint32_t nacks;           // attempts not acknowledged
+  uint32_t timeouts;        // attempts that timed out or hit a bus error
+  uint32_t retries;         // attempts after the first one
+  uint32_t failures;        // transfers given up
+  uint32_t retransmits;     // frames sent again, the board dropped them
+  uint32_t latency_us;      // transfer time, moving average
+  uint32_t latency_max_us;  // longest transfer
+} t_board_health;
+
+/**
+ * Writes to an address, retried with a growing delay
+ * @param address   7 bit address, I2C_GENERAL_CALL included
+ * @param data      bytes to write
+ * @param len       number of bytes
+ * @return false if every attempt failed
+*/
+bool bus_write(uint8_t address, const uint8_t *data, size_t len);
+
+/**
+ * Reads from an address, retried with a growing delay
+ * @param address   7 bit address
+ * @param buffer    filled with len bytes
+ * @param len       number of bytes
+ * @return false if no attempt returned len bytes
+*/
+bool bus_read(uint8_t address, uint8_t *buffer, size_t len);
+
+/**
+ * Tells if a board answers, a single empty write
+ * @param address   7 bit address
+ * @return true if the address was acknowledged
+*/
+bool bus_probe(uint8_t address);
+
+/**
+ * Probes every board address once BUS_RESCAN_INTERVAL elapsed since
+ * the last pass
+ * @return bit i set if board i (address i + 1) answers again after
+ *         missing a transfer or probe, 0 if no pass was due
+*/
+uint16_t bus_rescan();
+
+/**
+ * Sets the bus clock
+ * @param frequency   Hz
+*/
+void bus_set_clock(uint32_t frequency);
+
+/**
+ * @return bus clock, Hz
+*/
+uint32_t bus_get_clock();
+
+/**
+ * Neighbour of a clock in BUS_CLOCKS
+ * @param frequency   Hz
+ * @param faster      true for the next faster clock, false for slower
+ * @return Hz, 0 if there is none
+*/
+uint32_t bus_step_clock(uint32_t frequency, bool faster);
+
+/**
+ * Tells if the bus went bad since the last call: NACKs, timeouts and
+ * retransmits of the present boards over BUS_CLOCK_ERROR_PERMILLE of
+ * their transfers. Nothing is decided until BUS_CLOCK_WINDOW transfers
+ * went through, then the count restarts.
+ * @return true if the bus should slow down
+*/
+bool bus_errors_rising();
+
+/**
+ * Counts a frame sent again because the board did not accept it, the
+ * transfer itself went through
+ * @param address   7 bit address
+*/
+void bus_record_retransmit(uint8_t address);
+
+/**
+ * Counters of an address. They are written by the task owning the bus,
+ * other tasks may read a mix of two updates, fine for diagnostics.
+ * @param address   7 bit address (<= MAX_BOARDS)
+ * @return health
+*/
+t_board_health bus_health(uint8_t address);
+
+/**
+ * Writes the health of an address as a JSON object
+ * @param buffer    output, BUS_HEALTH_JSON_SIZE bytes are always enough
+ * @param size      buffer size
+ * @param address   7 bit address (<= MAX_BOARDS)
+ * @return length written
+*/
+size_t bus_health_json(char *buffer, size_t size, uint8_t address);
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef CHOREOGRAPHY_H
+#define CHOREOGRAPHY_H
+
+#include <Arduino.h>
+#include <TimeLib.h>
+
+/**
+ * Everything that drives the I2C bus (animations, adjustments, shutdown)
+ * runs in the choreography. On dual core ESP32s it is a task pinned to
+ * CHOREOGRAPHY_CORE, network services on the other core only talk to it
+ * through a lock-free command queue, so a slow client never delays a frame.
+ * On single core targets commands run immediately and choreography_loop()
+ * is called from loop().
+*/
+#if defined(ESP_PLATFORM) && !defined(CONFIG_FREERTOS_UNICORE)
+#define CHOREOGRAPHY_TASK 1
+#define CHOREOGRAPHY_CORE 1
+#define CHOREOGRAPHY_TASK_PRIORITY (configMAX_PRIORITIES - 5)
+// Timelines build the frames of every board on the stack
+#define CHOREOGRAPHY_TASK_STACK 6144
+#endif
+
+// Must be a power of two
+#define CHOREOGRAPHY_QUEUE_SIZE 16
+
+/**
+ * Starts the choreography task if the target has one
+*/
+void choreography_begin();
+
+/**
+ * Runs pending commands and animations, called by the task or by loop()
+*/
+void choreography_loop();
+
+/**
+ * Gives the current time to the choreography, which never calls the
+ * time library itself (it may block syncing). Repeated times are ignored,
+ * call it every loop: when t changes is when the second began.
+ * @param t   current local time
+*/
+void choreography_set_time(time_t t);
+
+/**
+ * Adjusts a single clock hands
+ * @param clock_index   single clock index (0 <= index < get_board_count() * 3)
+ * @param h_amount      hour hand angle
+ * @param m_amount      minute hand angle
+*/
+void choreography_adjust(int clock_index, int h_amount, int m_amount);
+
+/**
+ * Quickly stops the clock for OTA or restart
+*/
+void choreography_shutdown();
+
+#endif
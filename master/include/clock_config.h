@@ -25,6 +25,14 @@ enum clock_modes
 // Virtual mode for backward compatibility
 #define OFF 255
 
+// Layout of the saved settings, a different one is not loaded
+#define CONFIG_VERSION 1
+// Changes are written this long after the last one, a burst of them
+// goes out in a single flash write, ms
+#define CONFIG_WRITE_DELAY_MS 2000
+// Changes that keep coming are still written this often, ms
+#define CONFIG_WRITE_MAX_DELAY_MS 10000
+
 /**
  * Load configuration from the EEPROM
  */
@@ -36,10 +44,20 @@ void begin_config();
 void clear_config();
 
 /**
- * Closes the preferencies object
+ * Writes pending changes and closes the preferencies object
  */
 void end_config();
 
+/**
+ * Writes the settings once changes settle, call it every loop
+ */
+void update_config();
+
+/**
+ * Writes pending changes right away, before a restart
+ */
+void flush_config();
+
 /**
  * Get current clock mode (returns OFF if clock is disabled)
  */
@@ -73,9 +91,10 @@ int get_connection_mode();
 int get_active_connection_mode();
 
 /**
- * Gets current time zone based on UTC offset
+ * Gets current time zone
+ * @return POSIX TZ string
  */
-int get_timezone();
+const char *get_timezone();
 
 /**
  * Gets current SSID
@@ -156,7 +175,7 @@ void set_clock_enabled(bool value);
 void set_sleep_time(int day, int hour, bool value);
 
 /**
- *  Saves sleep time array on EEPROM
+ *  Saves sleep time array on EEPROM, with the next write
  */
 void save_sleep_time();
 
@@ -174,9 +193,9 @@ void set_active_connection_mode(int value);
 
 /**
  *  Sets the time zone
- * @param value   time zone based on UTC offset
+ * @param value   POSIX TZ string, see tz_parse()
  */
-void set_timezone(int value);
+void set_timezone(const char *value);
 
 /**
  *  Sets SSID value
@@ -232,6 +251,31 @@ void set_mqtt_enabled(bool value);
  */
 void set_speed_multiplier(int value);
 
+/**
+ * Gets the configured number of boards
+ * @return boards, 0 if they are found by scanning the bus
+ */
+int get_boards();
+
+/**
+ * Sets the number of boards, used from the next restart
+ * @param value   boards (1 to MAX_BOARDS), 0 to scan the bus
+ */
+void set_boards(int value);
+
+/**
+ * Gets the fastest bus clock allowed, lowered when the bus turns out
+ * unreliable
+ * @return Hz, 0 for no limit
+ */
+uint32_t get_bus_clock();
+
+/**
+ * Sets the fastest bus clock allowed, used from the next restart
+ * @param value   Hz, 0 for no limit
+ */
+void set_bus_clock(uint32_t value);
+
 /**
  * Gets daily restart enabled state
  * @return true if daily restart is enabled
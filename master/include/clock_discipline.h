@@ -0,0 +1,79 @@
+#ifndef CLOCK_DISCIPLINE_H
+#define CLOCK_DISCIPLINE_H
+
+#include <Arduino.h>
+
+// Exchanges per sync, the one with the shortest round trip is kept
+#define DISCIPLINE_BURST 4
+// Poll interval, doubled while offsets stay small, s
+#define DISCIPLINE_MIN_POLL 64
+#define DISCIPLINE_MAX_POLL (4 * 3600)
+// Offsets below let the poll interval grow, above halve it, ms
+#define DISCIPLINE_TIGHT_MS 25
+#define DISCIPLINE_LOOSE_MS 100
+// Offsets above are stepped and drift is estimated again, smaller ones
+// are slewed in over the next poll interval, ms
+#define DISCIPLINE_STEP_MS 1000
+// Drift is measured over at least this long, and at most a day so
+// millis() never wraps in between, s
+#define DISCIPLINE_DRIFT_MIN_SPAN (15 * 60)
+#define DISCIPLINE_DRIFT_MAX_SPAN (24 * 3600)
+// Crystals beyond this are broken, or the samples are, ppm
+#define DISCIPLINE_MAX_PPM 500
+
+/**
+ * One NTP exchange, server timestamps are Unix time in ms
+*/
+typedef struct ntp_sample
+{
+  unsigned long sent;       // millis() when the request left
+  unsigned long received;   // millis() when the reply came in
+  int64_t server_rx;        // request received by the server
+  int64_t server_tx;        // reply sent by the server
+} t_ntp_sample;
+
+/**
+ * Adds an exchange to the running sync, ignored once the burst is full
+ * @param sample    exchange
+*/
+void discipline_add_sample(const t_ntp_sample &sample);
+
+/**
+ * Number of exchanges in the running sync
+*/
+int discipline_samples();
+
+/**
+ * Ends the running sync: the clock is stepped to its best exchange, or
+ * slewed towards it if the offset is small, and the drift and poll
+ * interval are updated
+ * @return false if the sync had no exchange
+*/
+bool discipline_update();
+
+/**
+ * Tells if the clock was ever synced
+*/
+bool discipline_synced();
+
+/**
+ * Time at a given moment, crystal drift compensated. It never goes back
+ * between two syncs, nor when an offset is slewed
+ * @param at    millis() value, at most a few days from now
+ * @return Unix time in ms, 0 before the first sync
+*/
+int64_t discipline_time_ms(unsigned long at);
+
+/**
+ * Time until the next sync should start
+ * @return ms
+*/
+unsigned long discipline_poll_interval();
+
+/**
+ * Estimated crystal drift, positive if millis() runs slow
+ * @return ppb
+*/
+int32_t discipline_drift_ppb();
+
+#endif
@@ -6,6 +6,22 @@
 #include "digit.h"
 #include "clock_config.h"
 
+// Boards are read at most this often while waiting for them, ms
+#define BOARD_POLL_INTERVAL 50
+// Boards of the original clock, used when none answers the scan
+#define DEFAULT_BOARDS 8
+// Times a frame a board did not accept is sent again
+#define FRAME_RETRANSMITS 2
+// Echoes every board must pass for a bus clock to be used
+#define BUS_ECHO_ROUNDS 8
+
+typedef struct bus_frame
+{
+  uint8_t address;
+  uint8_t len;
+  uint8_t data[I2C_MAX_FRAME_SIZE];
+} t_bus_frame;
+
 /** 
  * Returns current direction
  * @return direction
@@ -43,24 +59,162 @@ void set_speed(int value);
 void set_acceleration(int value);
 
 /** 
- * Sends half digit to the specified board
- * @param index         board index (0 <= index < 8)
+ * Sends half digit to the specified board, only the clocks and fields
+ * that changed since the last state sent are transmitted
+ * @param index         board index (0 <= index < get_board_count())
  * @param half_digit    digit to send
 */
 void send_half_digit(int index, t_half_digit half_digit);
 
 /** 
- * Sends a digit to the specified boards
- * @param index         board index (0 <= index < 8)
+ * Stages half digit on the specified board without applying it,
+ * boards start moving together on commit_staged()
+ * @param index         board index (0 <= index < get_board_count())
+ * @param half_digit    digit to stage
+*/
+void stage_half_digit(int index, t_half_digit half_digit);
+
+/** 
+ * Broadcasts the commit of every staged half digit so all boards
+ * apply them at the same instant
+*/
+void commit_staged();
+
+/** 
+ * Encodes the frame send_half_digit() or stage_half_digit() would send,
+ * the board is then considered to have received it
+ * @param index         board index (0 <= index < get_board_count())
  * @param half_digit    digit to send
+ * @param staged        stage it for the next commit instead of applying it
+ * @param frame         filled with the frame
+ * @return false if there is nothing to send
+*/
+bool prepare_half_digit(int index, t_half_digit half_digit, bool staged, t_bus_frame *frame);
+
+/** 
+ * Encodes the commit of the frames prepared so far
+ * @param frame         filled with the frame
+ * @return false if nothing was staged
+*/
+bool prepare_commit(t_bus_frame *frame);
+
+/** 
+ * Sends a prepared frame, retried by the bus manager. Deltas and staged
+ * frames are checked against the sequence number the board accepted and
+ * sent again up to FRAME_RETRANSMITS times, commits are sent twice.
+ * A board that misses a frame gets a complete state with the next frame.
+ * @param frame         frame
+ * @return false if the frame was lost
+*/
+bool send_frame(const t_bus_frame *frame);
+
+/** 
+ * Sets the width of the grid and probes its boards, every board is sent
+ * a complete state next
+ * @param count   boards, 0 to scan the bus for them
+ * @return boards in use, DEFAULT_BOARDS if the scan found none
+*/
+int discover_boards(int count);
+
+/** 
+ * @return boards in use, columns of 3 clocks
+*/
+int get_board_count();
+
+/** 
+ * Picks the fastest bus clock every board echoes test patterns at
+ * without an error, call it once the boards were discovered
+ * @param limit   fastest clock allowed, Hz, 0 for none
+ * @return clock in use, Hz
+*/
+uint32_t select_bus_clock(uint32_t limit);
+
+/** 
+ * Probes the bus every BUS_RESCAN_INTERVAL, boards answering again are
+ * sent a complete state next. Slows the bus down and saves the slower
+ * clock as the limit when errors rise. Keep it away from running
+ * animations.
+*/
+void check_boards();
+
+/** 
+ * Forgets what the boards were sent, the next frames carry complete
+ * states. Needed when prepared frames are dropped instead of sent.
 */
-void send_digit(int index, t_digit digit);
+void resync_boards();
 
 /** 
- * Sends the full clock configuration to boards
+ * Reads the status block of a board
+ * @param index         board index (0 <= index < get_board_count())
+ * @param status        filled with the status
+ * @return false if the board did not answer with a valid block
+*/
+bool read_board_status(int index, t_board_status *status);
+
+/** 
+ * Reads the stepping engine instrumentation of a board, its maxima
+ * restart
+ * @param index         board index (0 <= index < get_board_count())
+ * @param stats         filled with the stats
+ * @return false if the board did not answer with a valid block
+*/
+bool read_board_stats(int index, t_board_stats *stats);
+
+/** 
+ * Tells if every board is done with the frames sent so far: nothing
+ * queued and no hand moving. Boards are read in one pass at most every
+ * BOARD_POLL_INTERVAL ms, sending a frame makes the answer false until
+ * the next pass. Boards missing from the bus are not waited for.
+ * @return true if all boards are idle
+*/
+bool boards_idle();
+
+/** 
+ * Returns the last state prepared for a board
+ * @param index         board index (0 <= index < get_board_count())
+ * @return half digit
+*/
+t_half_digit get_last_half_digit(int index);
+
+/** 
+ * Tells if a board knows the last state prepared for it, deltas are
+ * relative to it
+ * @param index         board index (0 <= index < get_board_count())
+ * @return false until the board is sent a complete state
+*/
+bool is_board_synced(int index);
+
+/** 
+ * Plans speeds so every hand of the given boards arrives at the same
+ * time, from the last state prepared for each board. Boards that need
+ * a resync are left out, where their hands are is not known.
+ * @param first         board index of half_digits[0]
+ * @param half_digits   states about to be prepared, rewritten in place
+ * @param count         number of boards
+ * @param include       boards taking part (count entries), NULL for all
+*/
+void plan_half_digits(int first, t_half_digit *half_digits, int count, const bool *include = NULL);
+
+/** 
+ * Returns the change counter for a new clock state and increments it
+ * @return change counter
+*/
+uint32_t take_change_counter();
+
+/** 
+ * Sends a digit to the specified boards, speeds are planned so
+ * every hand of the digit arrives at the same time
+ * @param index         digit index (0 <= index < MAX_DIGITS)
+ * @param half_digit    digit to send
+*/
+void send_digit(int index, const t_digit &digit);
+
+/** 
+ * Sends the full clock configuration to boards, speeds are planned
+ * so every hand arrives at the same time
  * @param full_clock    clock configuration
 */
-void send_clock(t_full_clock full_clock);
+void send_clock(const t_full_clock &full_clock);
 
 /** 
  * Converts t_half_digitl to t_half_digit
@@ -74,20 +228,20 @@ t_half_digit get_full_half_digit(t_half_digitl lite_digit);
  * the state counter
  * @param clock_state   clock state
 */
-void set_clock(t_full_clock clock_state);
+void set_clock(const t_full_clock &clock_state);
 
 /** 
  * Sends a digit to the specified boards and increments
  * the state counter
- * @param index     digit index (0 <= index < 4)
+ * @param index     digit index (0 <= index < MAX_DIGITS)
  * @param digit     digit value
 */
-void set_digit(int index, t_digit digit);
+void set_digit(int index, const t_digit &digit);
 
 /** 
  * Sends a half digit to the specified board and increments
  * the state counter
- * @param index     digit index (0 <= index < 8)
+ * @param index     digit index (0 <= index < get_board_count())
  * @param half      hlaf digit value
 */
 void set_half_digit(int index, t_half_digitl half);
@@ -108,7 +262,17 @@ void set_clock_time(int h, int m);
 t_full_clock get_clock_state_from_time(int h, int m);
 
 /** 
- * @param clock_index   single clock index (0 <= index < 24)
+ * Returns the glyph a digit shows for a time, the time is centered on
+ * the grid
+ * @param h       hour
+ * @param m       minute
+ * @param index   digit index (0 <= index < MAX_DIGITS)
+ * @return glyph index
+*/
+uint8_t get_time_glyph(int h, int m, int index);
+
+/** 
+ * @param clock_index   single clock index (0 <= index < get_board_count() * 3)
  * @param h_amount      hours hand degree of adjustment
  * @param m_amount      minutes hand degree of adjustment
 */
@@ -5,136 +5,261 @@
 #include "clock_state.h"
 
 /**
- * Digits
+ * Glyphs, index in font[]. The characters of glyph_chars are in the same
+ * order, glyphs after GLYPH_TEXT_END have no character.
+*/
+enum glyphs : uint8_t
+{
+  GLYPH_0, GLYPH_1, GLYPH_2, GLYPH_3, GLYPH_4,
+  GLYPH_5, GLYPH_6, GLYPH_7, GLYPH_8, GLYPH_9,
+  GLYPH_A, GLYPH_B, GLYPH_C, GLYPH_D, GLYPH_E, GLYPH_F, GLYPH_H, GLYPH_J,
+  GLYPH_L, GLYPH_N, GLYPH_O, GLYPH_P, GLYPH_R, GLYPH_T, GLYPH_U, GLYPH_Y,
+  GLYPH_BLANK, GLYPH_DASH, GLYPH_UNDERSCORE, GLYPH_DEGREE,
+  GLYPH_TEXT_END,
+  GLYPH_STOP = GLYPH_TEXT_END,
+  GLYPH_II,
+  GLYPH_FUN,
+  GLYPH_COUNT
+};
+
+// Hand directions
+#define G_R 0
+#define G_U 90
+#define G_L 180
+#define G_D 270
+// Both hands parked, the clock shows nothing
+#define G_X 225, 225
+
+/**
+ * Font, one contiguous table in flash
  * structure: {
- * h0, m0,
+ * h0, m0,   left column, top to bottom
  * h1, m1,
- * ...
+ * h2, m2,
+ * h3, m3,   right column, top to bottom
+ * h4, m4,
  * h5, m5
  * }
 */
-
-const t_digit digit_0 = {
-  270, 0,
-  270, 90,
-  0, 90,
-  270, 180,
-  270, 90,
-  180, 90
+constexpr t_digit font[GLYPH_COUNT] = {
+  // 0
+  {G_D, G_R,  G_D, G_U,  G_R, G_U,
+   G_D, G_L,  G_D, G_U,  G_L, G_U},
+  // 1
+  {G_X,  G_X,  G_X,
+   G_D, G_D,  G_D, G_U,  G_U, G_U},
+  // 2
+  {G_R, G_R,  G_D, G_R,  G_U, G_R,
+   G_L, G_D,  G_U, G_L,  G_L, G_L},
+  // 3
+  {G_R, G_R,  G_R, G_R,  G_R, G_R,
+   G_L, G_D,  G_L, G_U,  G_L, G_U},
+  // 4
+  {G_D, G_D,  G_U, G_R,  G_X,
+   G_D, G_D,  G_D, G_U,  G_U, G_U},
+  // 5
+  {G_D, G_R,  G_U, G_R,  G_R, G_R,
+   G_L, G_L,  G_D, G_L,  G_U, G_L},
+  // 6
+  {G_D, G_R,  G_D, G_U,  G_U, G_R,
+   G_L, G_L,  G_D, G_L,  G_U, G_L},
+  // 7
+  {G_R, G_R,  G_X,  G_X,
+   G_D, G_L,  G_D, G_U,  G_U, G_U},
+  // 8
+  {G_D, G_R,  G_U, G_R,  G_U, G_R,
+   G_D, G_L,  G_U, G_L,  G_U, G_L},
+  // 9
+  {G_D, G_R,  G_R, G_U,  G_R, G_R,
+   G_D, G_L,  G_D, G_U,  G_U, G_L},
+  // A
+  {G_D, G_R,  G_U, G_R,  G_U, G_U,
+   G_D, G_L,  G_U, G_L,  G_U, G_U},
+  // b
+  {G_D, G_D,  G_D, G_R,  G_U, G_R,
+   G_X,  G_D, G_L,  G_U, G_L},
+  // C
+  {G_D, G_R,  G_D, G_U,  G_U, G_R,
+   G_L, G_L,  G_X,  G_L, G_L},
+  // d
+  {G_X,  G_D, G_R,  G_U, G_R,
+   G_D, G_D,  G_D, G_L,  G_U, G_L},
+  // E
+  {G_D, G_R,  G_U, G_R,  G_U, G_R,
+   G_L, G_L,  G_L, G_L,  G_L, G_L},
+  // F
+  {G_D, G_R,  G_U, G_R,  G_U, G_U,
+   G_L, G_L,  G_L, G_L,  G_X},
+  // H
+  {G_D, G_D,  G_U, G_R,  G_U, G_U,
+   G_D, G_D,  G_U, G_L,  G_U, G_U},
+  // J
+  {G_X,  G_X,  G_R, G_R,
+   G_D, G_D,  G_D, G_U,  G_U, G_L},
+  // L
+  {G_D, G_D,  G_D, G_U,  G_U, G_R,
+   G_X,  G_X,  G_L, G_L},
+  // n
+  {G_X,  G_D, G_R,  G_U, G_U,
+   G_X,  G_D, G_L,  G_U, G_U},
+  // o
+  {G_X,  G_D, G_R,  G_U, G_R,
+   G_X,  G_D, G_L,  G_U, G_L},
+  // P
+  {G_D, G_R,  G_U, G_R,  G_U, G_U,
+   G_D, G_L,  G_U, G_L,  G_X},
+  // r
+  {G_X,  G_D, G_R,  G_U, G_U,
+   G_X,  G_L, G_L,  G_X},
+  // t
+  {G_D, G_D,  G_D, G_R,  G_U, G_R,
+   G_X,  G_L, G_L,  G_L, G_L},
+  // U
+  {G_D, G_D,  G_D, G_U,  G_U, G_R,
+   G_D, G_D,  G_D, G_U,  G_U, G_L},
+  // y
+  {G_D, G_D,  G_U, G_R,  G_R, G_R,
+   G_D, G_D,  G_D, G_U,  G_U, G_L},
+  // blank
+  {G_X,  G_X,  G_X,
+   G_X,  G_X,  G_X},
+  // -
+  {G_X,  G_R, G_R,  G_X,
+   G_X,  G_L, G_L,  G_X},
+  // _
+  {G_X,  G_X,  G_R, G_R,
+   G_X,  G_X,  G_L, G_L},
+  // degree
+  {G_D, G_R,  G_U, G_R,  G_X,
+   G_D, G_L,  G_U, G_L,  G_X},
+  // stop, every hand down
+  {G_D, G_D,  G_D, G_D,  G_D, G_D,
+   G_D, G_D,  G_D, G_D,  G_D, G_D},
+  // II
+  {G_D, G_U,  G_D, G_U,  G_D, G_U,
+   G_D, G_U,  G_D, G_U,  G_D, G_U},
+  // fun
+  {225, 45,  225, 45,  225, 45,
+   225, 45,  225, 45,  225, 45}
 };
 
-const t_digit digit_1 = {
-  225, 225,
-  225, 225,
-  225, 225,
-  270, 270,
-  270, 90,
-  90, 90
-};
+#undef G_R
+#undef G_U
+#undef G_L
+#undef G_D
+#undef G_X
 
-const t_digit digit_2 = {
-  0, 0,
-  270, 0,
-  90, 0,
-  180, 270,
-  90, 180,
-  180, 180
-};
+// Characters of the glyphs up to GLYPH_TEXT_END, upper case, * is the degree sign
+constexpr char glyph_chars[] = "0123456789ABCDEFHJLNOPRTUY -_*";
 
-const t_digit digit_3 = {
-  0, 0,
-  0, 0,
-  0, 0,
-  180, 270,
-  180, 90,
-  180, 90
-};
+static_assert(sizeof(glyph_chars) == GLYPH_TEXT_END + 1, "glyph_chars does not match the glyphs");
 
-const t_digit digit_4 = {
-  270, 270,
-  90, 0,
-  225, 225,
-  270, 270,
-  270, 90,
-  90, 90
-};
+constexpr char glyph_upper(char c)
+{
+  return c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c;
+}
 
-const t_digit digit_5 = {
-  270, 0,
-  90, 0,
-  0, 0,
-  180, 180,
-  270, 180,
-  90, 180
-};
+constexpr uint8_t glyph_find(char c, uint8_t index)
+{
+  return index == GLYPH_TEXT_END ? (uint8_t)GLYPH_BLANK
+    : glyph_chars[index] == c ? index
+    : glyph_find(c, index + 1);
+}
 
-const t_digit digit_6 = {
-  270, 0,
-  270, 90,
-  90, 0,
-  180, 180,
-  270, 180,
-  90, 180
-};
+// Letters drawn with the glyph of a digit
+constexpr char glyph_alias(char c)
+{
+  return c == 'S' ? '5' : c == 'I' ? '1' : c == 'G' ? '6' : c;
+}
 
-const t_digit digit_7 = {
-  0, 0,
-  225, 225,
-  225, 225,
-  270, 180,
-  270, 90,
-  90, 90
-};
+/**
+ * Glyph showing a character, case insensitive. S, I and G share the glyph
+ * of 5, 1 and 6, characters without glyph are blank
+ * @param c   character
+ * @return glyph index
+*/
+constexpr uint8_t glyph_from_char(char c)
+{
+  return glyph_find(glyph_alias(glyph_upper(c)), 0);
+}
 
-const t_digit digit_8 = {
-  270, 0,
-  90, 0,
-  90, 0,
-  270, 180,
-  90, 180,
-  90, 180
-};
+/**
+ * Glyph of a digit of the time
+ * @param h       hour
+ * @param m       minute
+ * @param index   digit index (0 <= index < 4), left to right
+ * @return glyph index
+*/
+constexpr uint8_t glyph_from_time(int h, int m, int index)
+{
+  return index == 0 ? h / 10 : index == 1 ? h % 10 : index == 2 ? m / 10 : m % 10;
+}
 
-const t_digit digit_9 = {
-  270, 0,
-  0, 90,
-  0, 0,
-  270, 180,
-  270, 90,
-  90, 180
-};
+// Glyph index-th of a list, the last one repeats
+template <uint8_t Glyph>
+constexpr uint8_t glyph_at(int)
+{
+  return Glyph;
+}
 
-const t_digit digit_null = {
-  270, 270,
-  270, 270,
-  270, 270,
-  270, 270,
-  270, 270,
-  270, 270
-};
+template <uint8_t Glyph, uint8_t Next, uint8_t... Rest>
+constexpr uint8_t glyph_at(int index)
+{
+  return index == 0 ? Glyph : glyph_at<Next, Rest...>(index - 1);
+}
 
-const t_digit digit_I = {
-  270, 90,
-  270, 90,
-  270, 90,
-  270, 90,
-  270, 90,
-  270, 90
-};
+template <int... Digits>
+struct digit_indexes {};
+
+template <int Count, int... Digits>
+struct make_digit_indexes : make_digit_indexes<Count - 1, Count - 1, Digits...> {};
 
-const t_digit digit_fun = {
-  225, 45,
-  225, 45,
-  225, 45,
-  225, 45,
-  225, 45,
-  225, 45,
+template <int... Digits>
+struct make_digit_indexes<0, Digits...>
+{
+  typedef digit_indexes<Digits...> type;
 };
 
-const t_full_clock d_stop = {digit_null, digit_null, digit_null, digit_null};
+template <uint8_t... Glyphs, int... Digits>
+constexpr t_full_clock render_digits(digit_indexes<Digits...>)
+{
+  return t_full_clock{{font[glyph_at<Glyphs...>(Digits)]...}};
+}
+
+/**
+ * Full clock built at compile time, the last glyph fills the digits
+ * up to MAX_DIGITS
+ * @tparam Glyphs   glyph indexes, left to right
+*/
+template <uint8_t... Glyphs>
+constexpr t_full_clock render()
+{
+  static_assert(sizeof...(Glyphs) > 0 && sizeof...(Glyphs) <= MAX_DIGITS, "a full clock shows 1 to MAX_DIGITS glyphs");
+  return render_digits<Glyphs...>(typename make_digit_indexes<MAX_DIGITS>::type());
+}
+
+/**
+ * Full clock showing the first MAX_DIGITS characters of a text, padded
+ * with blanks
+ * @param text    text, see glyph_from_char()
+ * @return full clock state
+*/
+inline t_full_clock render_text(const char *text)
+{
+  t_full_clock clock;
+  bool end = false;
+  for (int i = 0; i < MAX_DIGITS; i++)
+  {
+    end = end || text[i] == '\0';
+    clock.digit[i] = font[end ? (uint8_t)GLYPH_BLANK : glyph_from_char(text[i])];
+  }
+  return clock;
+}
+
+constexpr t_full_clock d_stop = render<GLYPH_STOP>();
 
-const t_full_clock d_fun = {digit_fun, digit_fun, digit_fun, digit_fun};
+constexpr t_full_clock d_fun = render<GLYPH_FUN>();
 
-const t_full_clock d_IIII = {digit_I, digit_I, digit_I, digit_I};
+constexpr t_full_clock d_IIII = render<GLYPH_II>();
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,41 @@
+#ifndef MOTION_PLANNER_H
+#define MOTION_PLANNER_H
+
+#include "clock_state.h"
+
+// Motor steps per hand revolution, STEPS on the slaves
+#define HAND_STEPS_PER_TURN 4320
+
+/**
+ * Steps a hand travels to reach an angle, same rules as
+ * ClockAccelStepper::moveToAngle() on the slaves
+ * @param from    angle the hand is at
+ * @param to      target angle
+ * @param mode    direction
+ * @return steps, 0 if the mode does not move the hand
+*/
+uint32_t planner_move_steps(uint16_t from, uint16_t to, uint8_t mode);
+
+/**
+ * Move duration of the profile run by the slaves
+ * @param steps   distance
+ * @param speed   max speed, steps/s
+ * @param accel   acceleration, steps/s^2
+ * @param scurve  S-curve ramps (CLOCK_FLAG_SCURVE) instead of trapezoidal
+ * @return duration in us
+*/
+uint64_t planner_move_duration(uint32_t steps, uint32_t speed, uint32_t accel, bool scurve);
+
+/**
+ * Rewrites speed and acceleration of the moving hands so every move ends
+ * at the same time. The slowest move keeps its profile, the others run it
+ * scaled down by their distance, so they speed up and brake together.
+ * Integer math only, cheap enough to run for every frame.
+ * @param from      states the boards were last sent
+ * @param to        states about to be sent, rewritten in place
+ * @param count     number of boards
+ * @param include   boards taking part (count entries), NULL for all
+*/
+void plan_synchronized(const t_half_digit *from, t_half_digit *to, int count, const bool *include = NULL);
+
+#endif
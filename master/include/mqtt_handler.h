@@ -18,6 +18,11 @@ void mqtt_handle();
  */
 void mqtt_publish_state();
 
+/**
+ * Publish the health of every board, one topic per I2C address
+ */
+void mqtt_publish_bus_health();
+
 /**
  * Publish Home Assistant auto-discovery configuration
  */
@@ -4,16 +4,34 @@
 #include <WiFiUdp.h>
 #include <WiFi.h>
 #include <TimeLib.h>
+#include <lwip/dns.h>
+#include <lwip/tcpip.h>
+#include "clock_discipline.h"
+#include "time_zone.h"
+
+/**
+ * SNTP client that never blocks: the lookup, the requests and the replies
+ * are spread over calls to update_NTP(). Each sync is a burst of
+ * exchanges handed to the clock discipline, TimeLib is set from it on
+ * every second edge. The time kept is UTC, TimeLib gets local time.
+*/
 
 // NTP Servers:
 static const char ntp_server_name[] = "pool.ntp.org";
 //static const char ntp_server_name[] = "time.nist.gov";
 
-int _time_zone = 1; // Central European Time
-// const int time_zone = -5;  // Eastern Standard Time (USA)
-// const int time_zone = -4;  // Eastern Daylight Time (USA)
-// const int time_zone = -8;  // Pacific Standard Time (USA)
-// const int time_zone = -7;  // Pacific Daylight Time (USA)
+// Time before trying again after a failed sync, ms
+#define NTP_RETRY_INTERVAL_MS 15000
+// Time between the exchanges of a burst, ms
+#define NTP_BURST_SPACING_MS 2000
+// TimeLib only follows second edges seen this soon, later ones would
+// delay its seconds, ms
+#define NTP_EDGE_LATE_MS 2
+#define NTP_REPLY_TIMEOUT_MS 1500
+#define NTP_DNS_TIMEOUT_MS 5000
+// Pool servers remembered, each one is used until it fails or expires
+#define NTP_SERVER_CACHE 4
+#define NTP_SERVER_TTL_MS (60 * 60 * 1000UL)
 
 WiFiUDP Udp;
 unsigned int local_port = 8888; // local port to listen for UDP packets
@@ -21,47 +39,326 @@ unsigned int local_port = 8888; // local port to listen for UDP packets
 const int NTP_PACKET_SIZE = 48;     // NTP time is in the first 48 bytes of message
 byte packet_buffer[NTP_PACKET_SIZE]; // buffer to hold incoming & outgoing packets
 
+enum ntp_states
+{
+  NTP_IDLE,
+  NTP_RESOLVING,      // waiting for a pool server address
+  NTP_WAITING         // waiting for the reply
+};
+
+typedef struct ntp_server
+{
+  uint32_t ip;        // 0 if unused
+  unsigned long resolved_at;
+} t_ntp_server;
+
+t_ntp_server _ntp_servers[NTP_SERVER_CACHE];
+int _ntp_server = 0;        // next server to ask
+int _ntp_asked = -1;        // server the request went to
+uint8_t _ntp_state = NTP_IDLE;
+unsigned long _ntp_next_sync = 0;
+unsigned long _ntp_sent_at = 0;
+// Transmit timestamp of the request, the reply echoes it back
+uint8_t _ntp_nonce[8];
+// Last second given to TimeLib, UTC
+int64_t _ntp_second = 0;
+
+// Lookup results come from the lwIP thread. _dns_lookup tells the
+// callback which lookup it answers, late answers to older ones are
+// dropped.
+uint32_t _dns_lookup = 0;
+uint32_t _dns_done = 0;
+uint32_t _dns_ip = 0;
+unsigned long _dns_started_at = 0;
+
 void begin_NTP();
-time_t get_NTP_time();
+void update_NTP();
 void send_NTP_packet(IPAddress &address);
 
 void begin_NTP()
 {
   Udp.begin(local_port);
+  _ntp_next_sync = millis();
+}
+
+static void dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+  uint32_t lookup = (uint32_t)(uintptr_t)arg;
+  if (lookup != __atomic_load_n(&_dns_lookup, __ATOMIC_ACQUIRE))
+    return;
+  _dns_ip = ipaddr && IP_IS_V4(ipaddr) ? ip4_addr_get_u32(ip_2_ip4(ipaddr)) : 0;
+  __atomic_store_n(&_dns_done, lookup, __ATOMIC_RELEASE);
+}
+
+// Runs in the lwIP thread, answers from the cache come back right away
+static void dns_start(void *arg)
+{
+  ip_addr_t address;
+  err_t err = dns_gethostbyname(ntp_server_name, &address, dns_found, arg);
+  if (err == ERR_OK)
+    dns_found(ntp_server_name, &address, arg);
+  else if (err != ERR_INPROGRESS)
+    dns_found(ntp_server_name, NULL, arg);
+}
+
+/**
+ * Starts looking up a pool server, the answer is picked up by
+ * update_NTP()
+*/
+static bool start_lookup()
+{
+  uint32_t lookup = __atomic_load_n(&_dns_lookup, __ATOMIC_RELAXED) + 1;
+  __atomic_store_n(&_dns_lookup, lookup, __ATOMIC_RELEASE);
+  _dns_started_at = millis();
+  return tcpip_callback(dns_start, (void *)(uintptr_t)lookup) == ERR_OK;
+}
+
+static bool lookup_pending()
+{
+  uint32_t lookup = __atomic_load_n(&_dns_lookup, __ATOMIC_RELAXED);
+  return lookup != 0 && __atomic_load_n(&_dns_done, __ATOMIC_ACQUIRE) != lookup;
 }
 
-time_t get_NTP_time()
+/**
+ * Adds the address of a finished lookup to the cache, in place of an
+ * expired server or the oldest one
+*/
+static void store_lookup()
 {
-  IPAddress ntp_server_IP; // NTP server's ip address
+  uint32_t ip = _dns_ip;
+  if (ip == 0)
+    return;
+  int slot = 0;
+  unsigned long oldest = 0;
+  for (int i = 0; i < NTP_SERVER_CACHE; i++)
+  {
+    if (_ntp_servers[i].ip == ip)
+    {
+      _ntp_servers[i].resolved_at = millis();
+      return;
+    }
+    unsigned long age = _ntp_servers[i].ip == 0 ? ~0UL : millis() - _ntp_servers[i].resolved_at;
+    if (age >= oldest)
+    {
+      oldest = age;
+      slot = i;
+    }
+  }
+  _ntp_servers[slot] = {ip, millis()};
+}
 
+/**
+ * Next cached server still valid, in turn
+ * @return cache index, -1 if there is none
+*/
+static int next_server(int *valid)
+{
+  int found = -1;
+  *valid = 0;
+  for (int i = 0; i < NTP_SERVER_CACHE; i++)
+  {
+    int index = (_ntp_server + i) % NTP_SERVER_CACHE;
+    const t_ntp_server &server = _ntp_servers[index];
+    if (server.ip == 0 || millis() - server.resolved_at >= NTP_SERVER_TTL_MS)
+      continue;
+    (*valid)++;
+    if (found < 0)
+      found = index;
+  }
+  if (found >= 0)
+    _ntp_server = (found + 1) % NTP_SERVER_CACHE;
+  return found;
+}
+
+static void send_request(int server)
+{
   while (Udp.parsePacket() > 0)
     ; // discard any previously received packets
-  Serial.println("Transmit NTP Request");
-  // get a random server from the pool
-  WiFi.hostByName(ntp_server_name, ntp_server_IP);
-  Serial.print(ntp_server_name);
-  Serial.print(": ");
-  Serial.println(ntp_server_IP);
-  send_NTP_packet(ntp_server_IP);
-  uint32_t begin_wait = millis();
-  while (millis() - begin_wait < 1500)
+  IPAddress address(_ntp_servers[server].ip);
+  Serial.print("Transmit NTP Request to ");
+  Serial.println(address);
+  _ntp_sent_at = millis();
+  send_NTP_packet(address);
+  _ntp_asked = server;
+  _ntp_state = NTP_WAITING;
+}
+
+static void finish_sync()
+{
+  discipline_update();
+  _ntp_state = NTP_IDLE;
+  _ntp_next_sync = millis() + discipline_poll_interval();
+}
+
+static void sync_failed(const char *reason)
+{
+  Serial.printf("NTP sync failed: %s\n", reason);
+  // The burst ends early, what it got is good enough
+  if (discipline_samples() > 0)
+  {
+    finish_sync();
+    return;
+  }
+  // A server that did not answer is not asked again
+  if (_ntp_state == NTP_WAITING && _ntp_asked >= 0)
+    _ntp_servers[_ntp_asked].ip = 0;
+  _ntp_state = NTP_IDLE;
+  _ntp_next_sync = millis() + NTP_RETRY_INTERVAL_MS;
+}
+
+/**
+ * NTP timestamp in the packet, seconds since 1900 and their fraction
+ * @param offset  first byte of the timestamp
+ * @return Unix time in ms
+*/
+static int64_t packet_timestamp_ms(int offset)
+{
+  // convert four bytes starting at offset to a long integer
+  uint32_t secs_since_1900;
+  secs_since_1900 = (uint32_t)packet_buffer[offset] << 24;
+  secs_since_1900 |= (uint32_t)packet_buffer[offset + 1] << 16;
+  secs_since_1900 |= (uint32_t)packet_buffer[offset + 2] << 8;
+  secs_since_1900 |= (uint32_t)packet_buffer[offset + 3];
+  uint32_t fraction;
+  fraction = (uint32_t)packet_buffer[offset + 4] << 24;
+  fraction |= (uint32_t)packet_buffer[offset + 5] << 16;
+  fraction |= (uint32_t)packet_buffer[offset + 6] << 8;
+  fraction |= (uint32_t)packet_buffer[offset + 7];
+  return ((int64_t)secs_since_1900 - 2208988800LL) * 1000 + (((uint64_t)fraction * 1000) >> 32);
+}
+
+/**
+ * Checks the reply answers the request that was sent and comes from a
+ * synchronized server
+ * @param sample  server timestamps filled in
+ * @return false if the packet is not a valid reply
+*/
+static bool parse_reply(t_ntp_sample *sample)
+{
+  uint8_t leap = packet_buffer[0] >> 6;
+  uint8_t mode = packet_buffer[0] & 0x07;
+  uint8_t stratum = packet_buffer[1];
+  if (mode != 4 || leap == 3 || stratum == 0 || stratum > 15)
+    return false;
+  if (memcmp(packet_buffer + 24, _ntp_nonce, sizeof(_ntp_nonce)) != 0)
+    return false;
+  sample->server_rx = packet_timestamp_ms(32);
+  sample->server_tx = packet_timestamp_ms(40);
+  return sample->server_tx >= sample->server_rx;
+}
+
+/**
+ * TimeLib counts seconds from the last setTime(), it is set again right
+ * on each second edge of the disciplined clock
+*/
+static void update_time_lib()
+{
+  if (!discipline_synced())
+    return;
+  int64_t ms = discipline_time_ms(millis());
+  int64_t second = ms / 1000;
+  if (second == _ntp_second)
+    return;
+  _ntp_second = second;
+  // DST changes and timezone edits show up on the next edge
+  time_t local = tz_local(second);
+  // An edge seen late still fixes a wrong second
+  if (ms % 1000 <= NTP_EDGE_LATE_MS || now() != local)
+    setTime(local);
+}
+
+/**
+ * Advances the sync, returns right away. Call it every loop.
+*/
+void update_NTP()
+{
+  if (lookup_pending() && millis() - _dns_started_at >= NTP_DNS_TIMEOUT_MS)
   {
-    int size = Udp.parsePacket();
-    if (size >= NTP_PACKET_SIZE)
+    // Answers to the lookup are dropped from now on
+    uint32_t lookup = _dns_lookup + 1;
+    __atomic_store_n(&_dns_lookup, lookup, __ATOMIC_RELEASE);
+    __atomic_store_n(&_dns_done, lookup, __ATOMIC_RELEASE);
+    _dns_ip = 0;
+    if (_ntp_state == NTP_RESOLVING)
+      sync_failed("DNS timeout");
+  }
+
+  switch (_ntp_state)
+  {
+    case NTP_IDLE:
     {
-      Serial.println("Receive NTP Response");
-      Udp.read(packet_buffer, NTP_PACKET_SIZE); // read packet into the buffer
-      unsigned long secs_since_1900;
-      // convert four bytes starting at location 40 to a long integer
-      secs_since_1900 = (unsigned long)packet_buffer[40] << 24;
-      secs_since_1900 |= (unsigned long)packet_buffer[41] << 16;
-      secs_since_1900 |= (unsigned long)packet_buffer[42] << 8;
-      secs_since_1900 |= (unsigned long)packet_buffer[43];
-      return secs_since_1900 - 2208988800UL + _time_zone * SECS_PER_HOUR;
+      if ((long)(millis() - _ntp_next_sync) < 0 || WiFi.status() != WL_CONNECTED)
+        break;
+      // The rest of a burst goes to the same server
+      if (discipline_samples() > 0)
+      {
+        send_request(_ntp_asked);
+        break;
+      }
+      int valid;
+      int server = next_server(&valid);
+      // The cache is refilled in the background while cached servers serve
+      bool lookup = valid < NTP_SERVER_CACHE && !lookup_pending();
+      if (lookup && !start_lookup())
+        lookup = false;
+      if (server >= 0)
+        send_request(server);
+      else if (lookup || lookup_pending())
+        _ntp_state = NTP_RESOLVING;
+      else
+        sync_failed("DNS unavailable");
+      break;
+    }
+    case NTP_RESOLVING:
+    {
+      if (lookup_pending())
+        break;
+      store_lookup();
+      int valid;
+      int server = next_server(&valid);
+      if (server >= 0)
+        send_request(server);
+      else
+        sync_failed("no address for server");
+      break;
+    }
+    case NTP_WAITING:
+    {
+      int size;
+      bool replied = false;
+      while (!replied && (size = Udp.parsePacket()) > 0)
+      {
+        unsigned long received = millis();
+        if (size < NTP_PACKET_SIZE)
+          continue;
+        Udp.read(packet_buffer, NTP_PACKET_SIZE); // read packet into the buffer
+        t_ntp_sample sample = {_ntp_sent_at, received, 0, 0};
+        if (!parse_reply(&sample))
+          continue; // stale or forged, keep waiting
+        discipline_add_sample(sample);
+        replied = true;
+      }
+      if (replied && discipline_samples() >= DISCIPLINE_BURST)
+        finish_sync();
+      else if (replied)
+      {
+        _ntp_state = NTP_IDLE;
+        _ntp_next_sync = millis() + NTP_BURST_SPACING_MS;
+      }
+      else if (millis() - _ntp_sent_at >= NTP_REPLY_TIMEOUT_MS)
+        sync_failed("no response");
+      break;
     }
   }
-  Serial.println("No NTP Response :-(");
-  return 0; // return 0 if unable to get the time
+
+  // Lookups started along with a request land in the cache for next time
+  if (_ntp_state != NTP_RESOLVING && _dns_lookup != 0 && !lookup_pending())
+  {
+    store_lookup();
+    _dns_ip = 0;
+  }
+
+  update_time_lib();
 }
 
 // send an NTP request to the time server at the given address
@@ -80,6 +377,11 @@ void send_NTP_packet(IPAddress &address)
   packet_buffer[13] = 0x4E;
   packet_buffer[14] = 49;
   packet_buffer[15] = 52;
+  // A random transmit timestamp, servers copy it into the originate
+  // timestamp of their reply
+  for (int i = 0; i < 8; i++)
+    _ntp_nonce[i] = random(256);
+  memcpy(packet_buffer + 40, _ntp_nonce, sizeof(_ntp_nonce));
   // all NTP fields have been given values, now
   // you can send a packet requesting a timestamp:
   Udp.beginPacket(address, 123); // NTP requests are to port 123
@@ -87,13 +389,4 @@ void send_NTP_packet(IPAddress &address)
   Udp.endPacket();
 }
 
-void set_ntp_timezone(int value)
-{
-  _time_zone = value;
-}
-
-int get_ntp_timezone()
-{
-  return _time_zone;
-}
-#endif
\ No newline at end of file
+#endif
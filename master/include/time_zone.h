@@ -0,0 +1,80 @@
+#ifndef TIME_ZONE_H
+#define TIME_ZONE_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// Longest POSIX TZ string, terminator included
+#define TZ_STRING_SIZE 64
+// Zone used when none is set
+#define TZ_DEFAULT "UTC0"
+
+enum tz_rule_types
+{
+  TZ_RULE_JULIAN,       // Jn, day 1 to 365, February 29 never counted
+  TZ_RULE_DAY,          // n, day 0 to 365, February 29 counted
+  TZ_RULE_MONTH_WEEK    // Mm.w.d, day d of week w (5 is the last) of month m
+};
+
+/**
+ * Day and time of a DST change
+*/
+typedef struct tz_rule
+{
+  uint8_t type;
+  uint8_t month;        // 1 to 12
+  uint8_t week;         // 1 to 5
+  uint8_t weekday;      // 0 is Sunday
+  uint16_t day;
+  int32_t time;         // s after midnight of the local time in force
+} t_tz_rule;
+
+/**
+ * Compiled POSIX TZ string, offsets are s east of UTC
+*/
+typedef struct time_zone
+{
+  int32_t std_offset;
+  int32_t dst_offset;
+  bool has_dst;
+  t_tz_rule start;      // DST begins, standard time
+  t_tz_rule end;        // DST ends, daylight time
+} t_time_zone;
+
+/**
+ * Compiles a POSIX TZ string, like "CET-1CEST,M3.5.0,M10.5.0/3".
+ * Zones with DST and no rules follow the US ones.
+ * @param posix   TZ string
+ * @param zone    filled with the rules
+ * @return false if the string is not valid
+*/
+bool tz_parse(const char *posix, t_time_zone *zone);
+
+/**
+ * Switches to a zone, nothing changes if the string is not valid
+ * @param posix   TZ string
+ * @return false if the string is not valid
+*/
+bool tz_set(const char *posix);
+
+/**
+ * Zone in use
+ * @return TZ string
+*/
+const char *tz_get();
+
+/**
+ * Local time, the offset is looked up again only past the next DST change
+ * @param utc   Unix time
+ * @return local time
+*/
+time_t tz_local(time_t utc);
+
+/**
+ * Writes a zone with a fixed offset
+ * @param minutes   offset east of UTC
+ * @param posix     filled with the TZ string, TZ_STRING_SIZE bytes
+*/
+void tz_fixed(int minutes, char *posix);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include "clock_manager.h"
+
+// Target of a keyframe: a clock index (0 <= index < get_board_count() * 3),
+// a board, every board in turn or every clock
+#define TIMELINE_BOARD(index) (0x80 | (index))
+#define TIMELINE_SWEEP 0xFE
+#define TIMELINE_ALL 0xFF
+
+// A TIMELINE_SWEEP keyframe runs on every board, each one this much later
+// than the board on its left, both start values move, ms
+#define TIMELINE_SWEEP_STEP 200
+
+// Angle replaced by the hand position of the time being displayed
+#define TIMELINE_ANGLE_TIME 0xFFFF
+
+// Mode flag: the keyframe also starts as soon as every board is idle,
+// the keyframes after it move earlier by the same amount. A sweep only
+// waits on its first board
+#define TIMELINE_WAIT 0x80
+// Mode flag: the hands use S-curve ramps, smoother at high speed
+#define TIMELINE_SCURVE 0x40
+
+// Keyframes of a timeline once sweeps are expanded
+#define TIMELINE_MAX_KEYFRAMES 32
+// Bytes of precomputed bus traffic of a timeline
+#define TIMELINE_BUFFER_SIZE (256 * MAX_BOARDS)
+
+/**
+ * Timeline keyframe, 14 bytes little endian so timelines can also be
+ * stored as binary blobs.
+ * A keyframe is sent to its boards at start_fixed + start_scaled / sqrt(speed
+ * multiplier) ms from the start of the timeline, keyframes sent at the same
+ * time start together. Boards queue keyframes, a clock still moving runs the
+ * next one as soon as it is done. Speed and acceleration are multiplied by
+ * the speed multiplier.
+*/
+typedef struct __attribute__((packed)) timeline_keyframe
+{
+  uint16_t start_fixed;   // ms
+  uint16_t start_scaled;  // ms at speed multiplier 1
+  uint8_t target;         // clock index, TIMELINE_BOARD(), TIMELINE_SWEEP or TIMELINE_ALL
+  uint8_t mode;           // direction of both hands, can have TIMELINE_WAIT and TIMELINE_SCURVE
+  uint16_t angle_h;       // degrees or TIMELINE_ANGLE_TIME
+  uint16_t angle_m;       // degrees or TIMELINE_ANGLE_TIME
+  uint16_t speed;         // steps/s
+  uint16_t accel;         // steps/s^2
+} t_timeline_keyframe;
+
+/**
+ * Plays a timeline showing the given time, the running animation is
+ * cancelled. Every frame is encoded before the first one is sent, playback
+ * only has to put them on the bus.
+ * @param keyframes   keyframes sorted by start time
+ * @param count       number of keyframes
+ * @param h           hours shown by TIMELINE_ANGLE_TIME
+ * @param m           minutes shown by TIMELINE_ANGLE_TIME
+ * @return false if the timeline is too long, more than TIMELINE_MAX_KEYFRAMES
+ *         once sweeps are expanded, nothing is played
+*/
+bool timeline_play(const t_timeline_keyframe *keyframes, int count, int h, int m);
+
+/**
+ * Works out how long a timeline would take, from its first step until
+ * the last hand stops. Follows the states the boards were last sent and
+ * runs the same motion profiles as the slaves, nothing is sent.
+ * @param keyframes   keyframes sorted by start time
+ * @param count       number of keyframes
+ * @param h           hours shown by TIMELINE_ANGLE_TIME
+ * @param m           minutes shown by TIMELINE_ANGLE_TIME
+ * @return ms, 0 if the timeline is too long to play
+*/
+unsigned long timeline_duration(const t_timeline_keyframe *keyframes, int count, int h, int m);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef TIMELINES_H
+#define TIMELINES_H
+
+#include "timeline.h"
+
+/***************** Built-in timelines *****************/
+const t_timeline_keyframe timeline_lazy[] = {
+  {0, 0, TIMELINE_ALL, MIN_DISTANCE, TIMELINE_ANGLE_TIME, TIMELINE_ANGLE_TIME, 200, 100}
+};
+
+const t_timeline_keyframe timeline_fun[] = {
+  {0, 0, TIMELINE_ALL, CLOCKWISE2 | TIMELINE_SCURVE, TIMELINE_ANGLE_TIME, TIMELINE_ANGLE_TIME, 400, 150}
+};
+
+// Every hand vertical, then the time rolls in board by board once they
+// all got there, the start times are the worst case
+const t_timeline_keyframe timeline_waves[] = {
+  {0, 0, TIMELINE_ALL, MIN_DISTANCE, 270, 90, 800, 150},
+  {4000, 5000, TIMELINE_SWEEP, CLOCKWISE2 | TIMELINE_SCURVE | TIMELINE_WAIT, TIMELINE_ANGLE_TIME, TIMELINE_ANGLE_TIME, 400, 100}
+};
+
+#define TIMELINE_LENGTH(timeline) ((int)(sizeof(timeline) / sizeof(t_timeline_keyframe)))
+
+#endif
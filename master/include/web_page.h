@@ -2,461 +2,490 @@
 #define WEB_PAGE_H
 #include <pgmspace.h>
 
-const uint8_t WEB_PAGE_HTML[7255] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbd, 0x3d, 0x6b, 0x77, 0xdb, 0x36, 
-  0xb2, 0xdf, 0xf7, 0x57, 0x30, 0x6c, 0x93, 0x88, 0x15, 0x49, 0x91, 0x7a, 0x59, 0x96, 0x44, 0xf9, 
-  0x26, 0xb1, 0xdd, 0xe4, 0x6e, 0x5c, 0xe7, 0xc6, 0xce, 0x76, 0x77, 0x73, 0x72, 0x12, 0x58, 0x84, 
-  0x2c, 0x6e, 0x28, 0x52, 0x4b, 0x42, 0x76, 0x5c, 0x45, 0xff, 0xfd, 0xce, 0x00, 0xe0, 0x53, 0xa4, 
-  0x24, 0xb7, 0xdb, 0x3d, 0x39, 0xb5, 0x48, 0x00, 0x33, 0x98, 0x17, 0xe6, 0x01, 0x40, 0xea, 0x78, 
-  0xce, 0x16, 0xfe, 0x64, 0x3c, 0xa7, 0xc4, 0x9d, 0x8c, 0x99, 0xc7, 0x7c, 0x3a, 0x79, 0xe5, 0x87, 
-  0xd3, 0xaf, 0xfc, 0x8f, 0xd2, 0xee, 0x2a, 0x8d, 0x88, 0x2e, 0x7d, 0x6f, 0x4a, 0x8c, 0xe0, 0x56, 
-  0x1b, 0xb7, 0xc4, 0x88, 0xb1, 0xef, 0x05, 0x5f, 0x95, 0x88, 0xfa, 0x8e, 0x37, 0x0d, 0x03, 0x65, 
-  0x1e, 0xd1, 0x99, 0xa3, 0xba, 0x84, 0x91, 0xa1, 0xb7, 0x20, 0xb7, 0xb4, 0x15, 0xdf, 0xdd, 0x36, 
-  0xbf, 0x2d, 0x7c, 0xfd, 0x69, 0xe7, 0x15, 0x3c, 0x2a, 0xf0, 0x18, 0xc4, 0xce, 0xf3, 0x39, 0x63, 
-  0xcb, 0x61, 0xab, 0x75, 0x7f, 0x7f, 0x6f, 0xde, 0x77, 0xcc, 0x30, 0xba, 0x6d, 0xb5, 0x2d, 0xcb, 
-  0xc2, 0xc1, 0xcf, 0x95, 0x3b, 0x8f, 0xde, 0xbf, 0x0c, 0xbf, 0x39, 0xcf, 0x2d, 0xc5, 0x52, 0xba, 
-  0xc7, 0xfc, 0xbf, 0xe7, 0x4f, 0x3b, 0x67, 0x88, 0x81, 0x3d, 0xf8, 0xf4, 0x00, 0x1c, 0x30, 0x5a, 
-  0x79, 0xda, 0xee, 0xcc, 0xc8, 0x9d, 0xf2, 0xf4, 0xe8, 0xa5, 0x12, 0xb3, 0x28, 0xfc, 0x4a, 0x87, 
-  0xd8, 0x04, 0x23, 0x46, 0xca, 0xcc, 0xf3, 0xfd, 0xec, 0xed, 0xe9, 0xd1, 0xa9, 0xf2, 0x3f, 0x0b, 
-  0xea, 0x7a, 0x44, 0x69, 0x2c, 0x81, 0x7c, 0x1a, 0xc5, 0xc6, 0x34, 0xf4, 0xc3, 0xc8, 0x88, 0xa7, 
-  0x73, 0xba, 0x00, 0x38, 0x97, 0x44, 0x5f, 0x35, 0x8e, 0xa9, 0x1a, 0xe9, 0x6c, 0x36, 0xcb, 0x21, 
-  0xe5, 0x6f, 0x88, 0x94, 0xff, 0xd7, 0x79, 0xd5, 0xe2, 0x54, 0x0b, 0x06, 0x6e, 0x15, 0xcf, 0x75, 
-  0x9e, 0x03, 0x0a, 0xc9, 0xd0, 0xad, 0xf8, 0x58, 0x12, 0x36, 0x57, 0xa0, 0xe3, 0xa2, 0xdd, 0xe9, 
-  0x98, 0x96, 0xd5, 0xd5, 0xad, 0x57, 0xb6, 0xd5, 0x35, 0xdb, 0x6d, 0x78, 0x82, 0x7f, 0xfc, 0xd9, 
-  0x6e, 0xc3, 0x93, 0xec, 0x9f, 0x42, 0x5b, 0x7b, 0x60, 0x1e, 0x0d, 0xec, 0xb4, 0x2f, 0x81, 0x2c, 
-  0x7d, 0x2a, 0x53, 0x31, 0x30, 0x07, 0x6c, 0x94, 0x40, 0x0c, 0xf9, 0xf9, 0xaa, 0xdb, 0xef, 0xc3, 
-  0xe7, 0x40, 0xa0, 0x6c, 0xb7, 0xf5, 0x4e, 0xdf, 0x36, 0x8f, 0x8e, 0xfb, 0x19, 0xa4, 0x6e, 0xfd, 
-  0xa6, 0x5c, 0xb4, 0xbb, 0x5d, 0xb3, 0x3b, 0x80, 0x09, 0xba, 0x6d, 0xb3, 0xdf, 0x3b, 0xf6, 0x8d, 
-  0x7e, 0xc7, 0xec, 0x01, 0xb6, 0xa3, 0x1e, 0x7c, 0xd8, 0xca, 0xd4, 0xe8, 0x99, 0x9d, 0x4e, 0x47, 
-  0xef, 0x9b, 0x1d, 0x98, 0xa9, 0x0b, 0x08, 0x8e, 0xf4, 0x23, 0xd3, 0xee, 0xf5, 0x8d, 0xb6, 0x6d, 
-  0xda, 0x9d, 0x9e, 0x6e, 0x9b, 0x83, 0x76, 0x77, 0x6a, 0xf0, 0x7e, 0x3e, 0xd4, 0xc0, 0xee, 0x23, 
-  0x31, 0xb6, 0x67, 0xf0, 0x6e, 0x39, 0xd6, 0xef, 0x1d, 0x9b, 0xc7, 0xc7, 0xb6, 0x71, 0x64, 0x9b, 
-  0x9d, 0x76, 0xef, 0x6f, 0xbd, 0x81, 0x69, 0xb5, 0x07, 0x53, 0xcb, 0x18, 0x98, 0x6d, 0x20, 0xa0, 
-  0x6f, 0x1e, 0xd9, 0x7d, 0xc3, 0x06, 0x8c, 0x00, 0xd5, 0x53, 0x62, 0x78, 0xe2, 0x4d, 0x3a, 0x6f, 
-  0xba, 0xb3, 0x8f, 0xba, 0xe6, 0xf1, 0x51, 0x7f, 0x6e, 0xbd, 0x6a, 0x77, 0x07, 0x52, 0x24, 0x7d, 
-  0xb3, 0xd7, 0xe9, 0x03, 0xe5, 0x30, 0xae, 0x77, 0x04, 0xef, 0x80, 0xbe, 0x87, 0xef, 0x05, 0x8e, 
-  0x7e, 0x7b, 0xde, 0x12, 0x5a, 0x69, 0xdd, 0x96, 0x3e, 0xc1, 0xb4, 0xe0, 0x49, 0x65, 0x0f, 0x4b, 
-  0xea, 0x14, 0xac, 0x7b, 0x32, 0xe6, 0x3a, 0x9e, 0xe0, 0x02, 0x5a, 0xdf, 0x7b, 0x2e, 0x9b, 0x0f, 
-  0x6d, 0xcb, 0x7a, 0x3a, 0x9a, 0x53, 0xef, 0x76, 0xce, 0xf8, 0xf3, 0xe6, 0x26, 0x74, 0x1f, 0xd6, 
-  0xae, 0x17, 0x2f, 0x7d, 0xf2, 0x30, 0x9c, 0xf9, 0xf4, 0xdb, 0x08, 0xff, 0x18, 0xae, 0x17, 0xd1, 
-  0x29, 0xf3, 0xc2, 0x60, 0x08, 0x36, 0xb7, 0x5a, 0x04, 0x23, 0xe2, 0x7b, 0xb7, 0x81, 0xe1, 0x31, 
-  0xba, 0x88, 0x87, 0x53, 0x1a, 0x30, 0x1a, 0x8d, 0xfe, 0xb5, 0x8a, 0x99, 0x37, 0x7b, 0x00, 0xab, 
-  0x84, 0xd7, 0x80, 0x25, 0xcd, 0x33, 0x78, 0x35, 0x66, 0x64, 0xe1, 0xf9, 0x0f, 0xc3, 0x6b, 0x32, 
-  0x0f, 0x17, 0x44, 0x7f, 0x4d, 0xfd, 0x3b, 0xca, 0x60, 0x89, 0xea, 0x31, 0x09, 0x62, 0x23, 0xa6, 
-  0x91, 0x37, 0x1b, 0x71, 0x63, 0x1e, 0xfe, 0x80, 0x76, 0x79, 0x43, 0xa6, 0x5f, 0x6f, 0xa3, 0x70, 
-  0x15, 0xb8, 0x86, 0x6c, 0x05, 0x43, 0x80, 0x7f, 0xa3, 0xe9, 0x2a, 0x8a, 0xe1, 0xd5, 0xa5, 0x33, 
-  0xb2, 0xf2, 0xd9, 0x68, 0x05, 0x90, 0x00, 0xed, 0x03, 0x69, 0xc3, 0x20, 0x0c, 0xa8, 0x98, 0x2b, 
-  0xf6, 0x7e, 0xa3, 0x43, 0xbb, 0xbb, 0xfc, 0xb6, 0xf9, 0x81, 0x44, 0x6c, 0xbd, 0x20, 0xd1, 0xad, 
-  0x17, 0x0c, 0x07, 0xd6, 0xf2, 0x9b, 0x62, 0x6d, 0x4c, 0xee, 0x0f, 0xd6, 0xb9, 0x81, 0xfd, 0xe5, 
-  0x37, 0x01, 0x77, 0x2f, 0xc4, 0x70, 0x04, 0xab, 0x4d, 0xc0, 0x18, 0x37, 0x21, 0x63, 0xe1, 0x62, 
-  0x38, 0x80, 0x11, 0x8c, 0x7e, 0x63, 0x06, 0x67, 0x5a, 0xf2, 0x05, 0x98, 0xa0, 0x69, 0x7d, 0xd0, 
-  0xc8, 0xf8, 0x21, 0x06, 0x41, 0x19, 0x31, 0x23, 0x2c, 0x5e, 0x4b, 0x8e, 0x6e, 0x06, 0xf8, 0x6f, 
-  0x7b, 0x74, 0x32, 0x37, 0x0b, 0x97, 0x1c, 0x5d, 0x71, 0x02, 0x4e, 0x2d, 0xf8, 0x32, 0x6a, 0x24, 
-  0x4a, 0x33, 0x7b, 0x1b, 0x92, 0xe0, 0x1c, 0x10, 0xfc, 0x27, 0x70, 0xba, 0x74, 0x1a, 0x46, 0x84, 
-  0xab, 0x0c, 0x45, 0xb3, 0x31, 0xe7, 0xc4, 0x9f, 0x81, 0x1e, 0x6f, 0x3d, 0xb6, 0x9e, 0xf9, 0x21, 
-  0x61, 0x43, 0x9f, 0xce, 0xd8, 0xc6, 0x9c, 0xa2, 0xdb, 0x5c, 0x1b, 0x46, 0xbc, 0x20, 0xbe, 0x6f, 
-  0xcc, 0x49, 0xe0, 0x0e, 0x8f, 0x2d, 0x97, 0xde, 0x8e, 0x0c, 0xc3, 0x87, 0xa9, 0x69, 0xb1, 0x89, 
-  0x04, 0x60, 0x51, 0x88, 0xd4, 0x60, 0x1e, 0xf8, 0x1c, 0xbb, 0x17, 0x8f, 0x84, 0x21, 0x0d, 0xee, 
-  0xee, 0x13, 0x3b, 0xc2, 0xc7, 0x9b, 0x30, 0x72, 0x41, 0x37, 0x11, 0x71, 0xbd, 0x55, 0x3c, 0xec, 
-  0x81, 0x91, 0xdd, 0x84, 0xdf, 0x8c, 0x78, 0x4e, 0xdc, 0xf0, 0x7e, 0xe8, 0x05, 0x31, 0x65, 0x0a, 
-  0xfa, 0xcd, 0x0e, 0xe8, 0x84, 0x6b, 0x3c, 0xa3, 0x28, 0xd1, 0xf1, 0x32, 0xf4, 0xb8, 0x38, 0x96, 
-  0x61, 0xec, 0x71, 0x2e, 0xc8, 0x4d, 0x0c, 0xa6, 0xc7, 0xa8, 0x24, 0x79, 0x18, 0xb0, 0xb9, 0x11, 
-  0xce, 0x0c, 0x34, 0xf3, 0x46, 0xd0, 0xb4, 0xb5, 0xf5, 0xd4, 0xa7, 0x24, 0xca, 0x73, 0x25, 0x18, 
-  0x78, 0x0d, 0xf4, 0xeb, 0xb2, 0x81, 0x33, 0x89, 0x0d, 0x6b, 0x16, 0x81, 0xe5, 0xcd, 0xc2, 0x68, 
-  0x61, 0x84, 0x91, 0x87, 0xf6, 0xd1, 0x43, 0xfb, 0x90, 0x2a, 0xe0, 0x9d, 0x5e, 0xc2, 0xa6, 0x17, 
-  0xdc, 0x1a, 0xb3, 0x55, 0x20, 0xcc, 0x9f, 0x92, 0x98, 0xe6, 0xfa, 0x87, 0x29, 0x1e, 0xe5, 0x8e, 
-  0x44, 0x8d, 0xb2, 0x80, 0xb4, 0x4d, 0xfd, 0xc4, 0xc3, 0x28, 0x04, 0x7b, 0xa0, 0xff, 0x6c, 0x08, 
-  0xc0, 0x4c, 0xfe, 0x9a, 0xb6, 0x45, 0x7f, 0x2d, 0x54, 0xa6, 0x22, 0x84, 0x9a, 0x7b, 0xae, 0x4b, 
-  0x03, 0xc5, 0xbc, 0x61, 0x81, 0x21, 0xf4, 0x9a, 0xac, 0x64, 0x6e, 0x02, 0x3f, 0x80, 0x5d, 0xd0, 
-  0x28, 0x20, 0xbe, 0x1c, 0x58, 0xec, 0xcd, 0x41, 0x6d, 0xc9, 0x5c, 0x2a, 0xb9, 0x9b, 0x29, 0x19, 
-  0x1f, 0xeb, 0x96, 0xa9, 0x3b, 0xdd, 0xa7, 0xed, 0x74, 0xf5, 0x99, 0x68, 0x2c, 0xe5, 0xd5, 0xb7, 
-  0xcb, 0xfd, 0x44, 0xe1, 0xbd, 0xf4, 0x3d, 0x25, 0x37, 0x53, 0xe3, 0x7d, 0x2a, 0xfc, 0x54, 0xd1, 
-  0xc0, 0x72, 0x7c, 0x0f, 0xe7, 0xe1, 0x1d, 0x8d, 0xd6, 0xdb, 0x6c, 0x4d, 0xfb, 0x16, 0xb1, 0x48, 
-  0x6e, 0x64, 0xf6, 0x64, 0x30, 0x7f, 0x5d, 0x34, 0x76, 0x90, 0x0c, 0xe7, 0xd6, 0xaa, 0x19, 0x1f, 
-  0x25, 0x3e, 0x03, 0x2d, 0x55, 0xc8, 0xb1, 0x00, 0x0f, 0x99, 0x84, 0xc0, 0x50, 0x0d, 0x7f, 0xe3, 
-  0xaf, 0x73, 0x1e, 0xa2, 0x0a, 0x9c, 0x27, 0x24, 0x77, 0xf7, 0x35, 0xe0, 0xdb, 0xd3, 0xef, 0x45, 
-  0xc7, 0xe9, 0x49, 0x6c, 0x12, 0x34, 0xbb, 0xae, 0x5c, 0xf2, 0xd2, 0xcf, 0x9a, 0x6d, 0x39, 0xb5, 
-  0x1c, 0x75, 0xd4, 0x06, 0x8f, 0x95, 0x18, 0x4d, 0xe6, 0xd0, 0x86, 0xdd, 0x2d, 0xdf, 0x36, 0x48, 
-  0x1c, 0x71, 0xea, 0xc0, 0x13, 0x5a, 0x04, 0x26, 0x6b, 0xb4, 0x24, 0xae, 0x0b, 0xab, 0x11, 0x9e, 
-  0xb6, 0x74, 0xc4, 0x17, 0xc8, 0x92, 0x44, 0xa0, 0xe2, 0x42, 0x24, 0xa9, 0xb2, 0xc3, 0x36, 0xda, 
-  0xa1, 0x3b, 0xc3, 0x7f, 0x65, 0x6f, 0xf3, 0x9f, 0x8d, 0x7c, 0x39, 0x37, 0x0b, 0x02, 0xa9, 0x35, 
-  0xaf, 0x9b, 0x2e, 0xfe, 0xeb, 0xde, 0xf0, 0x51, 0x26, 0x81, 0xd9, 0xee, 0x68, 0xc5, 0x30, 0x49, 
-  0x71, 0x25, 0x4b, 0x25, 0xa6, 0x04, 0x00, 0xe4, 0x8d, 0x02, 0xa5, 0x4b, 0x1e, 0x8c, 0xff, 0x28, 
-  0xda, 0x44, 0x13, 0x79, 0xd5, 0x15, 0x95, 0x89, 0xf6, 0x32, 0xa7, 0xd3, 0xaf, 0x99, 0xb9, 0x74, 
-  0xbb, 0x99, 0x21, 0xf0, 0x30, 0x56, 0x39, 0xa3, 0x8d, 0xf3, 0xe1, 0x0c, 0xb9, 0x88, 0x20, 0x2d, 
-  0xa6, 0x5d, 0x65, 0x31, 0xd9, 0x34, 0x7b, 0xc4, 0x9b, 0x0d, 0x34, 0x45, 0xc6, 0x40, 0xdd, 0x8a, 
-  0xb1, 0x5c, 0x64, 0xf3, 0x70, 0x15, 0x19, 0x3c, 0xba, 0x4b, 0xca, 0x07, 0x25, 0xca, 0xcb, 0xde, 
-  0xee, 0x4f, 0xb2, 0x9a, 0xfc, 0x6a, 0xc8, 0x31, 0xcf, 0x17, 0x2a, 0x72, 0x0e, 0xf6, 0x3e, 0x05, 
-  0x8e, 0x25, 0x65, 0x6d, 0xde, 0xe6, 0x05, 0xcb, 0x15, 0xcb, 0x13, 0x6f, 0xef, 0x5a, 0x80, 0x7b, 
-  0x97, 0xc7, 0xce, 0x75, 0x26, 0x57, 0xe7, 0xce, 0x05, 0x98, 0x18, 0x0a, 0x12, 0xbd, 0x65, 0x36, 
-  0x59, 0x03, 0x77, 0x46, 0x5c, 0xb6, 0x49, 0x4b, 0x94, 0x89, 0xbb, 0x9c, 0xac, 0x65, 0x02, 0x4a, 
-  0x04, 0xef, 0x05, 0x98, 0x13, 0x8d, 0xee, 0xe7, 0x20, 0x60, 0x83, 0x8b, 0x05, 0x62, 0xda, 0x7d, 
-  0x44, 0x96, 0x25, 0x0f, 0x92, 0x97, 0xcf, 0x70, 0x16, 0x4e, 0x57, 0xb1, 0x71, 0xe7, 0xc5, 0xde, 
-  0x0d, 0x64, 0x84, 0xe1, 0x8a, 0x21, 0x8e, 0x3c, 0x1f, 0x85, 0xd1, 0x43, 0x61, 0x35, 0xa0, 0xd2, 
-  0x75, 0x6e, 0x1d, 0x64, 0xf2, 0xe1, 0xec, 0x6e, 0xc4, 0xa0, 0xbc, 0x16, 0xea, 0x73, 0xd9, 0x2d, 
-  0x21, 0x81, 0xb3, 0x45, 0xfd, 0x94, 0xe2, 0xd3, 0x16, 0x4a, 0x25, 0x5c, 0x72, 0x32, 0x0e, 0xc0, 
-  0x2c, 0x6c, 0x39, 0xe6, 0x4e, 0xbb, 0x76, 0xe5, 0xff, 0x3e, 0xeb, 0x4d, 0x68, 0x46, 0x95, 0x6c, 
-  0xc6, 0xa2, 0x7a, 0x9c, 0x8c, 0x5b, 0xa2, 0x2c, 0xc7, 0x2a, 0x02, 0x6b, 0x48, 0xfc, 0x9c, 0x8c, 
-  0x5d, 0xef, 0x4e, 0x99, 0xfa, 0x24, 0x8e, 0x1d, 0x61, 0xb1, 0x30, 0x0c, 0x9a, 0xa0, 0x84, 0xb7, 
-  0x77, 0x56, 0xee, 0xd0, 0xcd, 0x41, 0x01, 0x0f, 0xe4, 0xf1, 0x09, 0x50, 0x1d, 0xb2, 0xac, 0x5d, 
-  0x54, 0xfc, 0x17, 0xa1, 0x4b, 0x73, 0x5d, 0x80, 0x64, 0x01, 0x2d, 0xf1, 0x63, 0xd1, 0x5c, 0x2d, 
-  0x29, 0x75, 0x95, 0x0b, 0xa8, 0x36, 0x3c, 0x20, 0x8d, 0x46, 0xd9, 0xb0, 0xc9, 0x98, 0xab, 0x44, 
-  0xe1, 0x75, 0x56, 0xb0, 0x5a, 0xdc, 0xd0, 0x88, 0xcf, 0x92, 0x0e, 0x55, 0xb8, 0x4c, 0x9c, 0xb4, 
-  0xd0, 0xc2, 0xfc, 0x92, 0x63, 0xce, 0xa9, 0x12, 0x92, 0x4b, 0xc7, 0x9e, 0x28, 0xe3, 0x9b, 0x15, 
-  0x2c, 0x88, 0x40, 0xf6, 0x83, 0xcb, 0xae, 0x80, 0x0d, 0x83, 0x29, 0xc8, 0xe6, 0xab, 0x13, 0x93, 
-  0x3b, 0xca, 0x25, 0x76, 0x45, 0x19, 0x03, 0x0d, 0xc4, 0x0d, 0x6d, 0x72, 0xf5, 0xe2, 0x6f, 0x67, 
-  0xe3, 0x96, 0x40, 0xf2, 0x68, 0x0e, 0x7d, 0x4a, 0x97, 0xca, 0x35, 0x64, 0xab, 0x45, 0x71, 0x41, 
-  0xd0, 0x28, 0x48, 0x0b, 0x9a, 0xb8, 0x31, 0x3d, 0x16, 0xff, 0xaf, 0x60, 0x4c, 0x3e, 0x8d, 0x63, 
-  0xe5, 0x55, 0x18, 0x04, 0xc2, 0xac, 0x8a, 0x58, 0xef, 0xbd, 0x99, 0x97, 0x07, 0xdb, 0x62, 0x9f, 
-  0xa7, 0xe6, 0x30, 0x10, 0x1c, 0xa5, 0x61, 0x65, 0x72, 0xe0, 0xeb, 0x22, 0x43, 0xda, 0xb0, 0xb4, 
-  0xc9, 0xeb, 0xcb, 0xeb, 0xab, 0x77, 0x97, 0xd7, 0x5b, 0x94, 0xec, 0x44, 0x69, 0xd7, 0xa3, 0xb4, 
-  0xb5, 0xc9, 0xd9, 0xdf, 0xaf, 0xcf, 0xde, 0xff, 0xf2, 0xe2, 0xad, 0xc4, 0x29, 0xfe, 0xf2, 0x84, 
-  0x1f, 0xc0, 0x93, 0x84, 0x5a, 0x4e, 0x23, 0xf3, 0xef, 0x30, 0x88, 0x57, 0x37, 0x0b, 0x8f, 0x39, 
-  0x11, 0x65, 0xab, 0x28, 0x78, 0x62, 0x27, 0xa6, 0xc2, 0x45, 0x18, 0xb3, 0x80, 0x2c, 0xe8, 0xb6, 
-  0x29, 0xc0, 0x1a, 0x9c, 0xd2, 0x79, 0xe8, 0x83, 0xbb, 0x72, 0x5e, 0x5f, 0x5e, 0x5d, 0xff, 0xf2, 
-  0xe2, 0xe2, 0x0c, 0x2c, 0x23, 0x85, 0x8c, 0x63, 0xcf, 0xdd, 0x0d, 0x75, 0x75, 0xf5, 0xe6, 0x14, 
-  0x2d, 0xca, 0xa7, 0xc1, 0x2d, 0x9b, 0x3b, 0xb6, 0x12, 0xd1, 0x7f, 0xaf, 0x40, 0xfa, 0x6e, 0x8a, 
-  0x86, 0xdb, 0xea, 0x12, 0x50, 0xdc, 0x83, 0x5b, 0x44, 0xa4, 0xe9, 0xf3, 0x4e, 0xc4, 0xef, 0x5e, 
-  0x5c, 0x5d, 0xfd, 0x7a, 0xf9, 0xbe, 0x16, 0xb9, 0xb4, 0x5e, 0x8e, 0x5d, 0xb0, 0x7e, 0xb8, 0x25, 
-  0x67, 0xc2, 0xde, 0x32, 0x63, 0x94, 0xf2, 0x23, 0x16, 0xfc, 0xff, 0x5d, 0x5f, 0xa3, 0x8d, 0xcd, 
-  0xbc, 0xdb, 0x95, 0x28, 0x7c, 0x4b, 0xca, 0x5a, 0xfc, 0x9b, 0x31, 0x83, 0xbf, 0x54, 0x28, 0x08, 
-  0xb1, 0x09, 0x4a, 0x0b, 0xee, 0xb0, 0xc2, 0xf1, 0x65, 0xe1, 0xb3, 0xe0, 0x01, 0x92, 0xec, 0x22, 
-  0x9d, 0x89, 0x06, 0x04, 0xe2, 0x8a, 0x2b, 0xb1, 0xaa, 0x42, 0x00, 0x6d, 0x2b, 0x0b, 0xc6, 0xfc, 
-  0x59, 0x62, 0xe3, 0x9e, 0x1f, 0xa3, 0x6f, 0xc9, 0xfb, 0xab, 0x20, 0x5d, 0x9f, 0xdc, 0x50, 0x5f, 
-  0x01, 0xc2, 0xab, 0xf0, 0x16, 0x87, 0x4f, 0xce, 0x78, 0xa7, 0x82, 0xb2, 0x18, 0xb7, 0x38, 0x60, 
-  0x22, 0xae, 0xd4, 0x8e, 0x38, 0x92, 0x1b, 0xdc, 0x15, 0x8c, 0x76, 0x6b, 0x5d, 0x7d, 0xf9, 0xfe, 
-  0xf2, 0xaf, 0x67, 0xef, 0x95, 0x17, 0xa7, 0xa7, 0xef, 0xcf, 0xae, 0xae, 0xd4, 0xa2, 0x15, 0xe5, 
-  0x3c, 0x1e, 0x22, 0x5c, 0x86, 0x11, 0xdb, 0x63, 0x44, 0x97, 0xef, 0xaf, 0xa1, 0x48, 0xf6, 0x57, 
-  0xd4, 0xb1, 0x07, 0x83, 0x8e, 0x70, 0x7d, 0xca, 0x82, 0x7c, 0x73, 0xfa, 0xbd, 0x5e, 0xa7, 0x97, 
-  0x37, 0x75, 0x8e, 0x11, 0x37, 0x77, 0xf6, 0xaf, 0x14, 0xf5, 0xc3, 0x15, 0x2e, 0xcf, 0x8b, 0x33, 
-  0xa5, 0x21, 0xc2, 0x22, 0xf1, 0x35, 0xb5, 0xde, 0xde, 0x05, 0xad, 0x07, 0x19, 0xbd, 0x9a, 0x5a, 
-  0x7d, 0x11, 0xf3, 0x1f, 0x30, 0xf6, 0x0b, 0x98, 0x5d, 0x58, 0xe8, 0x1f, 0x35, 0xf6, 0x73, 0x2f, 
-  0x5a, 0xdc, 0x43, 0x92, 0xa2, 0x7c, 0x58, 0xba, 0x84, 0xe5, 0x3d, 0xb7, 0xa0, 0x60, 0x2b, 0x4f, 
-  0x9e, 0x8c, 0x97, 0x93, 0x97, 0x21, 0x89, 0xdc, 0xa1, 0x32, 0x06, 0xd4, 0x81, 0x88, 0xce, 0xf0, 
-  0x6e, 0xa0, 0x8c, 0x27, 0x6f, 0x43, 0x82, 0xd1, 0xdc, 0x34, 0x4d, 0x08, 0xe5, 0xd0, 0x0d, 0xf3, 
-  0x2e, 0x27, 0x7b, 0xb0, 0xf2, 0x9c, 0xb4, 0xb0, 0x5a, 0xaa, 0x33, 0xda, 0x6c, 0x05, 0xae, 0x96, 
-  0x90, 0xba, 0xb9, 0x35, 0x6b, 0x50, 0xa1, 0xc1, 0x94, 0x0b, 0x55, 0x44, 0x50, 0x08, 0xf9, 0x5c, 
-  0x26, 0x06, 0xee, 0xd2, 0x17, 0xe6, 0x1f, 0x5a, 0x85, 0x85, 0x37, 0xf3, 0xc0, 0xe0, 0x01, 0xf9, 
-  0x4c, 0x8a, 0xc4, 0xe0, 0x0d, 0x64, 0x3a, 0xa5, 0x4b, 0xe6, 0x98, 0x37, 0x5e, 0x50, 0x5a, 0xd7, 
-  0xb8, 0xd9, 0x81, 0x5a, 0x99, 0x93, 0xe0, 0x96, 0x4a, 0x92, 0x12, 0x71, 0x82, 0x5a, 0x8a, 0x0a, 
-  0xde, 0x1d, 0x97, 0x7b, 0x79, 0x05, 0x3f, 0x77, 0x21, 0x9f, 0x5c, 0x00, 0xc7, 0xe6, 0x2d, 0x65, 
-  0x67, 0x3e, 0xc5, 0xc7, 0x97, 0x0f, 0x6f, 0xdc, 0x86, 0x5a, 0xa0, 0x4c, 0xd5, 0x4c, 0x3e, 0xbe, 
-  0xa1, 0x3d, 0x9f, 0x7c, 0x78, 0xf7, 0xf6, 0xf2, 0xc5, 0xa9, 0x72, 0xfe, 0xe6, 0xed, 0xb6, 0x25, 
-  0xfc, 0x4e, 0x2a, 0x66, 0x94, 0x4d, 0xe7, 0x09, 0x3b, 0xe7, 0x51, 0xb8, 0xf8, 0xd9, 0x63, 0xf3, 
-  0xd5, 0x0d, 0x30, 0xf6, 0xe1, 0xdd, 0xe9, 0x8b, 0xeb, 0x33, 0xe5, 0xfc, 0xfd, 0xe5, 0x85, 0xf2, 
-  0xf3, 0x9b, 0xeb, 0xd7, 0x1f, 0x5e, 0x56, 0x65, 0x0c, 0x75, 0x8a, 0x06, 0xfb, 0x11, 0x1a, 0x44, 
-  0x73, 0xe3, 0x3b, 0x99, 0xab, 0xb8, 0xa4, 0x95, 0x24, 0xef, 0x1c, 0x0c, 0x06, 0x65, 0xf3, 0x39, 
-  0xc4, 0xa4, 0x4f, 0x89, 0xe7, 0x3f, 0x28, 0xef, 0x29, 0xe0, 0x8e, 0x58, 0x0d, 0x45, 0xc2, 0xe6, 
-  0xb6, 0xf6, 0x4c, 0xf7, 0x58, 0x7e, 0x8d, 0x97, 0x76, 0x71, 0x42, 0x23, 0x12, 0x13, 0xfe, 0x19, 
-  0xee, 0x7a, 0xd7, 0x04, 0xd5, 0x7e, 0x9b, 0xac, 0x80, 0x68, 0x88, 0x5d, 0x53, 0x85, 0xc3, 0x2a, 
-  0x12, 0x56, 0x21, 0xac, 0xe4, 0xcd, 0x6b, 0xc2, 0xd5, 0xe1, 0x9b, 0x60, 0xb7, 0x64, 0x29, 0x84, 
-  0x23, 0x72, 0x9e, 0x6d, 0x79, 0x60, 0xae, 0xb7, 0xed, 0x20, 0xf3, 0x86, 0x87, 0x3b, 0xea, 0x93, 
-  0xb1, 0xf0, 0x8d, 0xd2, 0xb1, 0x5b, 0x13, 0xcb, 0x1a, 0x5a, 0xd6, 0xb8, 0x25, 0x5a, 0x4b, 0xbd, 
-  0xf6, 0xc4, 0xb2, 0xeb, 0x7b, 0xdb, 0x13, 0xab, 0x5d, 0xdf, 0xdb, 0x99, 0x58, 0x9d, 0xfa, 0xde, 
-  0xee, 0xc4, 0xea, 0xd6, 0xf7, 0xf6, 0x26, 0x56, 0xaf, 0xbe, 0xb7, 0x3f, 0xb1, 0xfa, 0xf5, 0xbd, 
-  0x47, 0x13, 0xeb, 0xa8, 0xbe, 0x77, 0x30, 0xb1, 0x06, 0xf5, 0xbd, 0xc7, 0x13, 0xeb, 0x78, 0x87, 
-  0x34, 0xac, 0x89, 0xbd, 0x4b, 0x58, 0xf6, 0xc4, 0xde, 0x21, 0x2d, 0xbb, 0x3d, 0xb1, 0x77, 0x88, 
-  0xcb, 0xee, 0x4c, 0xec, 0x1d, 0xf2, 0xb2, 0xbb, 0x13, 0x7b, 0x87, 0xc0, 0xec, 0xde, 0xc4, 0xde, 
-  0x21, 0x31, 0xbb, 0x3f, 0xb1, 0x77, 0x88, 0xcc, 0x3e, 0x9a, 0xd8, 0x3b, 0x64, 0x66, 0x0f, 0x26, 
-  0xf6, 0x0e, 0xa1, 0xd9, 0xc7, 0x13, 0x7b, 0x87, 0xd4, 0xda, 0xd6, 0xa4, 0xbd, 0x43, 0x6a, 0x6d, 
-  0x7b, 0xd2, 0xde, 0x65, 0x63, 0xed, 0x49, 0x7b, 0x87, 0xd4, 0xda, 0x9d, 0x49, 0xbb, 0x28, 0xb5, 
-  0x96, 0x58, 0x1e, 0x8f, 0x8a, 0x0a, 0x5b, 0x61, 0x9f, 0x7b, 0x36, 0xe9, 0xd8, 0xca, 0x81, 0xff, 
-  0x77, 0x87, 0x1b, 0xb9, 0x4e, 0x4f, 0xe9, 0x9d, 0x37, 0xc5, 0xb8, 0x05, 0x29, 0xda, 0xf5, 0x0b, 
-  0xc8, 0xb0, 0x7e, 0xb9, 0xfc, 0xb5, 0xec, 0xd7, 0xf7, 0xfb, 0x61, 0x2c, 0x2f, 0x72, 0x67, 0x54, 
-  0xc9, 0xb8, 0x5c, 0x13, 0x38, 0x0a, 0x3c, 0xa0, 0x98, 0x9c, 0x47, 0x94, 0x2a, 0xaf, 0x29, 0x78, 
-  0x8f, 0x2c, 0x8f, 0xc0, 0x01, 0xc6, 0x0c, 0x3a, 0x0c, 0xa8, 0xfe, 0x97, 0x13, 0xc3, 0x48, 0x73, 
-  0x08, 0x01, 0x33, 0xbe, 0x89, 0x12, 0xf0, 0x0f, 0x4b, 0x7e, 0x6e, 0x54, 0x82, 0x5d, 0xf1, 0xd6, 
-  0x0a, 0xc0, 0x83, 0x23, 0x08, 0xf8, 0x26, 0xcc, 0x70, 0xe4, 0x2c, 0xaf, 0x78, 0xed, 0x9f, 0x9b, 
-  0x9c, 0x88, 0x13, 0x7f, 0x3c, 0x8b, 0x8f, 0x87, 0xad, 0xd6, 0x2d, 0x8f, 0x89, 0xe6, 0x34, 0x5c, 
-  0xb4, 0x40, 0xf1, 0x80, 0x61, 0x3a, 0xf9, 0xd9, 0x23, 0xf0, 0x1a, 0x2a, 0x7f, 0x83, 0xf7, 0x30, 
-  0x22, 0x81, 0x37, 0x6e, 0x91, 0x7d, 0xb0, 0xf7, 0x50, 0xcc, 0x81, 0xb7, 0x66, 0x93, 0xe4, 0x81, 
-  0xc3, 0x60, 0xe4, 0xcb, 0x28, 0xe1, 0x5b, 0x1b, 0xe9, 0xa1, 0xd0, 0x2e, 0xa2, 0x16, 0x24, 0x58, 
-  0x99, 0x81, 0x17, 0xfc, 0x8b, 0xb4, 0x94, 0xc9, 0x05, 0xbc, 0x40, 0x14, 0xf9, 0xd5, 0xa3, 0x31, 
-  0xee, 0x39, 0x94, 0xd1, 0x9e, 0xd2, 0x18, 0x3c, 0x7a, 0x1d, 0x36, 0x79, 0xdd, 0x60, 0xbe, 0x02, 
-  0x94, 0x50, 0x35, 0x06, 0x53, 0x6a, 0x1f, 0x0f, 0xda, 0x9c, 0x64, 0x65, 0xf2, 0x9a, 0xb7, 0x2a, 
-  0xbc, 0x59, 0xc1, 0xf6, 0x14, 0xbb, 0x10, 0x6a, 0x3c, 0x8d, 0xbc, 0x25, 0x9b, 0xf8, 0x14, 0x9c, 
-  0x3d, 0xee, 0x0c, 0x38, 0x1f, 0x5f, 0x44, 0x11, 0x79, 0x68, 0xb4, 0xbb, 0x9a, 0x89, 0x97, 0x07, 
-  0xa0, 0xcc, 0xd6, 0xff, 0x8b, 0x2d, 0x9f, 0xf4, 0x64, 0xb7, 0x16, 0x37, 0x74, 0x1c, 0x4b, 0xe7, 
-  0xa7, 0x10, 0x22, 0x5c, 0xba, 0xce, 0x13, 0x2b, 0xed, 0xe6, 0x92, 0x76, 0xee, 0x42, 0x28, 0x92, 
-  0xb3, 0xc6, 0x53, 0xf2, 0x50, 0x6e, 0xca, 0x0a, 0xce, 0xb4, 0x07, 0xb7, 0x78, 0xb2, 0x1d, 0x1e, 
-  0xc7, 0xd6, 0xb1, 0xd4, 0x76, 0x54, 0x55, 0x4f, 0x0a, 0x05, 0x7c, 0x4e, 0x0a, 0x77, 0x7c, 0xc6, 
-  0x2a, 0x22, 0x25, 0xc1, 0xe6, 0xaf, 0x2f, 0x79, 0x41, 0x95, 0x74, 0xbe, 0x83, 0x6a, 0x88, 0x57, 
-  0x39, 0xfc, 0xed, 0x83, 0xac, 0x64, 0xd2, 0xde, 0x0c, 0xed, 0x28, 0x39, 0x58, 0x54, 0x38, 0x5f, 
-  0x0d, 0xaa, 0xad, 0x45, 0x3e, 0xfc, 0x25, 0x59, 0x97, 0xaa, 0x38, 0x76, 0xf9, 0x71, 0x4d, 0x37, 
-  0xaa, 0xb4, 0x76, 0x35, 0x3d, 0x89, 0x51, 0xc4, 0x8e, 0x83, 0x0a, 0x6a, 0xbb, 0xbb, 0x2d, 0xf4, 
-  0x0a, 0x7c, 0x86, 0x84, 0xe3, 0x0e, 0xc4, 0x51, 0xc1, 0x35, 0xa9, 0x8a, 0x48, 0x67, 0xe4, 0x4b, 
-  0x72, 0x8b, 0x45, 0xe5, 0x7b, 0xef, 0x16, 0xff, 0x4f, 0x4d, 0x7d, 0x8c, 0x2a, 0x37, 0x44, 0x38, 
-  0x69, 0x88, 0x09, 0x0a, 0xa0, 0x31, 0xbf, 0x05, 0x52, 0x20, 0x24, 0x3d, 0xdc, 0x54, 0x15, 0xa0, 
-  0xf7, 0xa2, 0x67, 0xe9, 0xdd, 0x23, 0xe5, 0x55, 0x77, 0x60, 0x76, 0xba, 0x1d, 0xbb, 0xdb, 0x1b, 
-  0xe0, 0x6b, 0xf7, 0x48, 0xcf, 0x1a, 0xf0, 0xad, 0x67, 0xc1, 0x10, 0xf8, 0xb0, 0xcd, 0x7e, 0xaf, 
-  0x3f, 0xe8, 0x75, 0xdb, 0x4a, 0x0e, 0xa0, 0xd7, 0x51, 0x00, 0x0b, 0xfc, 0x7d, 0x7b, 0xdc, 0x4b, 
-  0x3e, 0x00, 0xc9, 0x5b, 0x81, 0xfa, 0x9f, 0xaa, 0xbc, 0xd6, 0xe2, 0xa8, 0x98, 0xcc, 0xab, 0xfc, 
-  0x52, 0x8b, 0xa3, 0xfe, 0x70, 0x7e, 0x7e, 0x2e, 0x9e, 0x8d, 0x68, 0x85, 0x39, 0x1c, 0xbd, 0xa3, 
-  0x41, 0xe8, 0xba, 0x2a, 0x9a, 0x37, 0x10, 0x5d, 0x45, 0x7a, 0x7a, 0xc2, 0xfa, 0x27, 0x90, 0x0e, 
-  0xa2, 0x4c, 0x3f, 0xff, 0x03, 0xc4, 0xe3, 0x2d, 0x8e, 0xbc, 0xcf, 0x53, 0xd3, 0x43, 0x3d, 0x25, 
-  0x7f, 0x1a, 0x99, 0xd3, 0x1e, 0x71, 0x31, 0x1f, 0x44, 0xee, 0xb8, 0xf2, 0x74, 0xb0, 0x75, 0xc5, 
-  0x06, 0x15, 0xbe, 0x6e, 0x6e, 0x39, 0xd0, 0x6a, 0x64, 0xd1, 0x2e, 0x64, 0x36, 0xe0, 0x03, 0x64, 
-  0x17, 0x07, 0x22, 0xbb, 0xd9, 0x47, 0x99, 0xc1, 0x49, 0x33, 0x0e, 0xc4, 0xb6, 0x93, 0x34, 0x23, 
-  0xa1, 0xcd, 0xc8, 0x47, 0xc0, 0x2f, 0x9b, 0x74, 0xb1, 0xdd, 0xd2, 0x00, 0xdd, 0x49, 0xdc, 0xd0, 
-  0xd6, 0x77, 0x24, 0x52, 0xe8, 0x08, 0xdd, 0x1d, 0x73, 0xca, 0x8b, 0x4e, 0xa6, 0xec, 0x6a, 0x8e, 
-  0x12, 0xe5, 0xc7, 0x75, 0xde, 0x03, 0x9d, 0xa8, 0xe2, 0x5c, 0x4d, 0x1d, 0xaa, 0xea, 0x46, 0x2d, 
-  0x16, 0x0f, 0x0a, 0xcf, 0x04, 0x46, 0x4a, 0xb1, 0x22, 0x51, 0xf8, 0x19, 0x46, 0x8e, 0x7a, 0x16, 
-  0xde, 0xde, 0xfa, 0x62, 0x47, 0x57, 0x22, 0x6d, 0x00, 0xe9, 0xe5, 0x69, 0x2e, 0x7f, 0x81, 0x29, 
-  0x2e, 0xc1, 0x46, 0x36, 0x92, 0x19, 0x9d, 0x38, 0xd6, 0x08, 0xaa, 0x8c, 0x06, 0x14, 0xb3, 0xb3, 
-  0x8f, 0xea, 0xdb, 0x17, 0xff, 0xfc, 0x87, 0xaa, 0xab, 0xe7, 0x1f, 0x7e, 0x81, 0xbf, 0xbf, 0x42, 
-  0x86, 0x71, 0xa5, 0x7e, 0xd2, 0x58, 0x33, 0xc7, 0x12, 0x6e, 0x7f, 0x83, 0x3b, 0x20, 0x9b, 0x12, 
-  0x3b, 0xc4, 0x71, 0x9c, 0xbc, 0x8f, 0x2d, 0xb1, 0x54, 0xf2, 0x05, 0x38, 0x02, 0xa4, 0x4c, 0x9a, 
-  0xcd, 0x0d, 0xa7, 0x92, 0x26, 0xf4, 0x8c, 0x6a, 0xcb, 0x5f, 0xbe, 0xef, 0x0e, 0x65, 0xaf, 0x07, 
-  0x8e, 0x37, 0x7a, 0x7d, 0x7d, 0xf1, 0xd6, 0x61, 0x05, 0x4d, 0x70, 0xd6, 0x51, 0x15, 0x42, 0x09, 
-  0xcf, 0xf3, 0xba, 0xcf, 0x2e, 0xad, 0xa8, 0x93, 0xe7, 0x9c, 0x5d, 0x1c, 0x04, 0x71, 0x60, 0x44, 
-  0xc7, 0xed, 0xee, 0x88, 0x36, 0x9b, 0x1a, 0x7d, 0xda, 0x71, 0x1c, 0xeb, 0xd9, 0x33, 0xeb, 0x89, 
-  0x43, 0x9f, 0x3d, 0x6b, 0x00, 0xcf, 0xcf, 0xb7, 0x6d, 0xa8, 0x80, 0x47, 0xd3, 0x61, 0x50, 0xe2, 
-  0x6f, 0x47, 0xf0, 0xac, 0x0a, 0x00, 0x55, 0xaf, 0xe5, 0x01, 0x32, 0xad, 0x1d, 0x1c, 0x40, 0x98, 
-  0x29, 0x9b, 0x12, 0xb8, 0xfa, 0xa2, 0x82, 0x2e, 0x2e, 0x51, 0x33, 0xd7, 0x1f, 0xce, 0x50, 0x3f, 
-  0x67, 0xa7, 0xf8, 0xfc, 0xfa, 0x03, 0x6a, 0xec, 0xfd, 0x1b, 0xf8, 0x7b, 0xf5, 0xe2, 0x1a, 0xff, 
-  0x82, 0xf6, 0x4a, 0x5a, 0xc3, 0xa3, 0xdb, 0xb2, 0xd2, 0xb6, 0x94, 0x02, 0xf3, 0x3f, 0x52, 0x27, 
-  0xb8, 0xb9, 0xbf, 0x83, 0xa1, 0xd7, 0xb8, 0xd1, 0xdf, 0x60, 0x42, 0x25, 0xa4, 0xa4, 0x92, 0xe4, 
-  0x44, 0x49, 0x15, 0xc7, 0x20, 0x65, 0xb5, 0x40, 0x69, 0xc2, 0xf5, 0x42, 0x12, 0x36, 0x72, 0x70, 
-  0xbc, 0x88, 0x2c, 0x92, 0x48, 0x52, 0xf1, 0x73, 0x6c, 0x6a, 0x09, 0x5b, 0x19, 0x19, 0xca, 0x84, 
-  0x63, 0x2a, 0x06, 0xc4, 0xa4, 0xac, 0xff, 0x71, 0x6d, 0xa3, 0x39, 0x63, 0xe2, 0xf2, 0x91, 0x7d, 
-  0xfa, 0x48, 0x3f, 0x9d, 0xa8, 0x89, 0x6d, 0x57, 0xdb, 0x33, 0x72, 0x9a, 0x86, 0xb6, 0xfd, 0x24, 
-  0x21, 0x39, 0x63, 0x47, 0x5a, 0xde, 0x6e, 0x0e, 0x9f, 0xb6, 0xbb, 0x87, 0x30, 0xc9, 0x31, 0x96, 
-  0x11, 0xfe, 0x97, 0xb9, 0xdc, 0x67, 0xfd, 0x5c, 0xe5, 0x05, 0x73, 0x21, 0x99, 0xb9, 0xe4, 0xfc, 
-  0x02, 0x64, 0x2f, 0x22, 0xa7, 0x7a, 0x52, 0x74, 0x29, 0xcf, 0x9e, 0xed, 0x74, 0x0e, 0x86, 0xda, 
-  0xcc, 0x8f, 0xc6, 0x0d, 0x32, 0xe0, 0xf7, 0xad, 0x17, 0x33, 0x33, 0xa2, 0x8b, 0xf0, 0x8e, 0x36, 
-  0x12, 0x97, 0xa4, 0x15, 0xb3, 0x41, 0x5a, 0x4f, 0xf2, 0x1e, 0xbc, 0xc4, 0x75, 0xf3, 0x48, 0x71, 
-  0x6f, 0x16, 0x19, 0xc8, 0x0f, 0x2f, 0x64, 0x9a, 0x5a, 0xc6, 0x6f, 0x95, 0xbf, 0x5e, 0x17, 0xb3, 
-  0xd2, 0xfc, 0xdb, 0x88, 0x7b, 0x05, 0xa7, 0x96, 0xd0, 0x62, 0xa4, 0xd1, 0x46, 0x94, 0xdf, 0x2b, 
-  0x7c, 0x25, 0x36, 0x70, 0x9c, 0x9a, 0x20, 0x50, 0xa0, 0xed, 0x84, 0xd6, 0x31, 0x36, 0xa4, 0xbb, 
-  0x44, 0xd9, 0x28, 0x20, 0xe1, 0xd5, 0x24, 0xe7, 0x6a, 0x18, 0xb3, 0x70, 0xc9, 0x9f, 0xb4, 0xc6, 
-  0x23, 0x65, 0x93, 0xb9, 0x23, 0x30, 0x05, 0xf0, 0xfa, 0xe9, 0xab, 0x96, 0x4f, 0xc9, 0xc1, 0x3a, 
-  0xd0, 0x53, 0xe7, 0x93, 0xf4, 0x1d, 0x9a, 0x44, 0x0f, 0x98, 0x29, 0x12, 0x06, 0x6f, 0xe9, 0x31, 
-  0xbb, 0xde, 0x02, 0x5c, 0xa5, 0xde, 0x8b, 0x6a, 0x39, 0xc2, 0x0a, 0xb4, 0x6c, 0x1b, 0x29, 0x34, 
-  0xef, 0xb0, 0xd1, 0x9d, 0x14, 0x24, 0x62, 0x2d, 0x10, 0x51, 0x51, 0x7f, 0x3c, 0x62, 0x71, 0xc1, 
-  0x0a, 0x2e, 0x49, 0x94, 0xaf, 0x5f, 0x2a, 0x22, 0x0c, 0x93, 0x0b, 0x7f, 0x49, 0xa2, 0x98, 0xbe, 
-  0x09, 0x58, 0x5e, 0x8e, 0x1a, 0x3a, 0x83, 0xd1, 0x9e, 0x7e, 0x07, 0x9d, 0x07, 0x3b, 0xb1, 0x86, 
-  0xb6, 0x6e, 0xf1, 0xa7, 0x9d, 0xa4, 0x01, 0xe7, 0xdb, 0x2b, 0x27, 0xf5, 0x36, 0xda, 0xf0, 0x51, 
-  0xc0, 0x89, 0xb0, 0x32, 0x78, 0x6e, 0x5f, 0xfc, 0x08, 0x1a, 0x4f, 0xa0, 0xf3, 0xb4, 0xea, 0xbb, 
-  0xd8, 0xa8, 0x50, 0xad, 0xa8, 0x52, 0x2a, 0x94, 0xcb, 0x3b, 0x76, 0xa8, 0x57, 0xac, 0xc0, 0x4c, 
-  0xc1, 0xc2, 0xf4, 0xcb, 0x2c, 0xcb, 0x4a, 0x4b, 0xab, 0x2c, 0x38, 0xcb, 0xfa, 0x7a, 0x95, 0x14, 
-  0x73, 0x25, 0xe2, 0x4a, 0xc0, 0x3b, 0xac, 0x7e, 0x2f, 0x51, 0x89, 0x28, 0x13, 0xba, 0xb6, 0x48, 
-  0xc8, 0x0e, 0x56, 0xab, 0xdc, 0x72, 0xd6, 0x0d, 0x2b, 0xb1, 0x9e, 0x8a, 0x30, 0xc8, 0xd3, 0x90, 
-  0xc2, 0xec, 0x74, 0xd1, 0xb5, 0xd8, 0x92, 0xd3, 0x72, 0xb5, 0x56, 0xb8, 0x1a, 0xb7, 0x48, 0x70, 
-  0x0e, 0xdb, 0x53, 0x0a, 0xa7, 0xb1, 0x83, 0x8f, 0x93, 0xc6, 0x76, 0x1b, 0x48, 0xb8, 0x7c, 0xc8, 
-  0xac, 0x0d, 0x2b, 0x87, 0xd9, 0x62, 0xde, 0xc7, 0xd1, 0x5e, 0xd6, 0xc1, 0x0e, 0x75, 0x1e, 0x20, 
-  0xc8, 0x82, 0xeb, 0xce, 0xab, 0x33, 0x00, 0x9b, 0x67, 0x34, 0x49, 0x30, 0x9d, 0x80, 0xde, 0x2b, 
-  0xd8, 0xa0, 0x33, 0xfe, 0x78, 0x1e, 0x46, 0x0b, 0x78, 0x25, 0x23, 0xc0, 0xb0, 0x5c, 0xc2, 0x60, 
-  0xa0, 0x47, 0xd5, 0x29, 0x92, 0x20, 0x1c, 0xa1, 0x66, 0xb2, 0xf0, 0x8a, 0x45, 0x5e, 0x70, 0x0b, 
-  0xdc, 0xeb, 0xd9, 0xa8, 0x85, 0x1c, 0x75, 0xe1, 0x05, 0x2b, 0x46, 0xeb, 0xc7, 0xc5, 0x72, 0xdc, 
-  0x15, 0x05, 0x2e, 0xdc, 0xfa, 0x71, 0xa7, 0x72, 0x9c, 0x20, 0xb6, 0x66, 0xd0, 0x85, 0xaa, 0x37, 
-  0xc4, 0xac, 0x10, 0xe1, 0xe6, 0x0d, 0xad, 0x69, 0xd7, 0x8d, 0xfc, 0x87, 0x44, 0x77, 0xbe, 0xf2, 
-  0xfd, 0x7f, 0x50, 0x12, 0xd5, 0xa2, 0xc4, 0xbd, 0xc3, 0xdf, 0xb0, 0x94, 0x96, 0x98, 0xaf, 0xe5, 
-  0xfb, 0xe5, 0x6c, 0x16, 0x53, 0xd6, 0xd0, 0x5a, 0x46, 0xdf, 0x2a, 0xc2, 0xf2, 0x43, 0xb2, 0x86, 
-  0xda, 0x42, 0x48, 0x55, 0x5f, 0x2f, 0x28, 0x9b, 0x87, 0xee, 0x50, 0x5d, 0x86, 0x31, 0x53, 0x75, 
-  0xbc, 0xb3, 0x34, 0x64, 0x1b, 0x6d, 0x43, 0xe2, 0x87, 0x60, 0xaa, 0xa4, 0x7a, 0x10, 0x47, 0x5f, 
-  0xc9, 0xf1, 0xad, 0xd4, 0x05, 0xb9, 0x27, 0x1e, 0x6b, 0xf0, 0xbf, 0x4a, 0x82, 0x75, 0xca, 0x87, 
-  0xe4, 0xf0, 0x02, 0x4d, 0xea, 0x46, 0xd3, 0xcc, 0x7f, 0xc5, 0x68, 0x80, 0xc2, 0x3d, 0x3b, 0xd4, 
-  0xe4, 0x9f, 0x9f, 0x91, 0x06, 0xbd, 0x3a, 0x20, 0xa5, 0xa1, 0x2c, 0xef, 0xfa, 0x4a, 0x19, 0x90, 
-  0xb8, 0x95, 0xfb, 0x79, 0x51, 0x0e, 0xca, 0xd2, 0x31, 0xa1, 0x55, 0xcb, 0x21, 0x32, 0xc5, 0xf8, 
-  0xfe, 0xbd, 0xd4, 0xa0, 0x67, 0xc5, 0x70, 0x01, 0xc3, 0xf7, 0xef, 0x69, 0x1e, 0x90, 0x3a, 0xae, 
-  0xbc, 0x53, 0x31, 0xef, 0xe5, 0xc5, 0x1e, 0x3e, 0xb9, 0xb6, 0xb5, 0x8d, 0x06, 0x0c, 0x62, 0xcb, 
-  0xe7, 0xec, 0x42, 0xd4, 0xf7, 0xef, 0xf6, 0x8e, 0x84, 0x2d, 0x1d, 0x06, 0x4b, 0x4c, 0x6c, 0xc7, 
-  0x97, 0x30, 0xd6, 0xc3, 0xe2, 0x7e, 0x5d, 0x06, 0x85, 0x9b, 0x77, 0x30, 0x39, 0x7c, 0xd4, 0x43, 
-  0x24, 0x3b, 0x7b, 0x29, 0x54, 0xba, 0xd5, 0x47, 0xcd, 0xe4, 0x71, 0x57, 0xc8, 0x16, 0x7b, 0x81, 
-  0x29, 0x74, 0xba, 0x39, 0x48, 0xcd, 0xe4, 0xb1, 0xb0, 0x49, 0x48, 0x4d, 0x7c, 0xcb, 0x54, 0x50, 
-  0xdc, 0x34, 0x94, 0xbd, 0xe2, 0x4e, 0xc6, 0xf7, 0xef, 0xf9, 0x3d, 0x44, 0xd9, 0x85, 0xb7, 0x2b, 
-  0x40, 0x7a, 0x5b, 0x1b, 0x8a, 0xb2, 0x3b, 0xb9, 0x2a, 0xc1, 0x61, 0xeb, 0x25, 0x9c, 0xbb, 0x3d, 
-  0x82, 0x6e, 0x0c, 0xab, 0x09, 0x2a, 0xae, 0x44, 0x48, 0x3a, 0xf7, 0xc0, 0x0a, 0x02, 0x53, 0xa6, 
-  0x33, 0x0e, 0xf6, 0xc0, 0x21, 0xf5, 0x05, 0x28, 0x64, 0x6d, 0x0f, 0x4c, 0xc2, 0x52, 0x01, 0x2e, 
-  0xe1, 0x3b, 0x73, 0x8e, 0xb9, 0xad, 0x1f, 0xf0, 0x87, 0x3a, 0x11, 0xeb, 0x32, 0x2c, 0x3a, 0xc6, 
-  0x30, 0x75, 0x15, 0x5e, 0xe0, 0xd2, 0x6f, 0xe8, 0x57, 0xf2, 0xde, 0x20, 0xeb, 0x5e, 0x7c, 0x26, 
-  0x8b, 0x70, 0x15, 0x80, 0x13, 0x60, 0x35, 0x23, 0xe6, 0xe9, 0x08, 0x52, 0xe9, 0x51, 0x04, 0x3d, 
-  0xd5, 0x3e, 0x25, 0xdc, 0xe4, 0xbd, 0x7a, 0x92, 0x56, 0x03, 0xd9, 0x82, 0x68, 0x52, 0x24, 0x9a, 
-  0x64, 0x54, 0xc1, 0xb0, 0x32, 0xcd, 0x59, 0x6f, 0xa2, 0x50, 0x9d, 0x9d, 0xa8, 0x36, 0x94, 0x07, 
-  0x96, 0x9a, 0x51, 0x23, 0x20, 0xab, 0x68, 0x21, 0x65, 0x5a, 0x4a, 0x37, 0x0a, 0xd7, 0xe5, 0xd5, 
-  0x9c, 0xa6, 0x61, 0x8f, 0x58, 0xc0, 0xda, 0x28, 0x0b, 0x58, 0x29, 0x5f, 0x34, 0xe3, 0x2b, 0x03, 
-  0x28, 0x3b, 0x8f, 0x4a, 0xd9, 0xc6, 0x92, 0xba, 0x6a, 0x8e, 0xa0, 0xb6, 0xdd, 0xa4, 0xb4, 0x41, 
-  0x28, 0x3d, 0xbb, 0x83, 0x07, 0x8c, 0xab, 0x14, 0xd2, 0x6a, 0xcc, 0xa7, 0xa0, 0x1c, 0x56, 0xf5, 
-  0x84, 0x67, 0xcc, 0x89, 0x54, 0x84, 0x53, 0xb9, 0x87, 0x64, 0xb8, 0x0d, 0xcc, 0x4c, 0xcf, 0xc5, 
-  0x64, 0xa8, 0x94, 0xb2, 0x15, 0x4a, 0x07, 0x6d, 0xc3, 0x2b, 0x8c, 0x64, 0xcb, 0x2a, 0xef, 0x3b, 
-  0xd3, 0x7d, 0x20, 0xbe, 0x03, 0x04, 0x51, 0x9d, 0xf1, 0xb4, 0x36, 0x7f, 0x04, 0x91, 0xa4, 0xb9, 
-  0xe1, 0x8a, 0xc9, 0xb6, 0x51, 0x41, 0x09, 0x59, 0x1e, 0x4c, 0xd1, 0x94, 0x0b, 0x38, 0x78, 0x7a, 
-  0xc2, 0xbf, 0xe2, 0x24, 0x31, 0x34, 0xf2, 0xe8, 0x34, 0xbd, 0x30, 0x98, 0x16, 0xe7, 0x8a, 0x45, 
-  0x50, 0x44, 0xa0, 0x86, 0xe6, 0x4c, 0x64, 0x19, 0x51, 0x93, 0x3c, 0x40, 0x21, 0x53, 0xb2, 0xb6, 
-  0xea, 0x7d, 0xb7, 0x7c, 0xba, 0xd1, 0x04, 0x7a, 0xa1, 0xb2, 0x28, 0x02, 0x25, 0x6a, 0x43, 0x4a, 
-  0xea, 0xa3, 0xac, 0x6e, 0xf7, 0x2c, 0x6b, 0x2b, 0xd8, 0x96, 0xb3, 0xb6, 0x35, 0xf7, 0xea, 0x07, 
-  0x05, 0x80, 0xec, 0xd4, 0xe6, 0x60, 0xef, 0x9f, 0x1d, 0xee, 0x1c, 0xec, 0xf2, 0xf7, 0x98, 0x36, 
-  0x5f, 0x78, 0xdb, 0xe9, 0x5e, 0xc1, 0xae, 0xb3, 0xe1, 0x9c, 0x7c, 0x7e, 0xea, 0x94, 0x6f, 0x4d, 
-  0xa9, 0x4c, 0x39, 0xca, 0xf7, 0xa6, 0x04, 0xa5, 0xc4, 0x83, 0x57, 0x28, 0xe7, 0x21, 0x72, 0xda, 
-  0xda, 0x15, 0xa3, 0x97, 0x2c, 0x03, 0xcc, 0x9a, 0x9f, 0x53, 0x42, 0x66, 0x8b, 0xd7, 0xa2, 0xc0, 
-  0xaa, 0xdb, 0xb4, 0x53, 0xa9, 0x9c, 0xfc, 0x55, 0xb6, 0x75, 0x3e, 0xd4, 0x3d, 0x32, 0xfc, 0xe4, 
-  0xe3, 0xe0, 0x63, 0xa2, 0x4f, 0x16, 0x22, 0x0f, 0xf0, 0x4c, 0xe5, 0x20, 0xa4, 0x15, 0xa3, 0xe8, 
-  0xe3, 0x22, 0x51, 0xf1, 0x08, 0x6f, 0xcf, 0xa4, 0x25, 0x43, 0xdb, 0x6d, 0x35, 0xa9, 0x2b, 0xcf, 
-  0xc9, 0x33, 0x73, 0xea, 0xd9, 0x38, 0x29, 0x89, 0x9c, 0xe8, 0x0a, 0x66, 0x83, 0x8c, 0xa6, 0xe2, 
-  0xa9, 0xb1, 0xb8, 0x94, 0xa9, 0x82, 0x24, 0xaa, 0xad, 0x2f, 0xcf, 0x6f, 0xd9, 0xc6, 0xb0, 0xaf, 
-  0xde, 0xba, 0x88, 0x4f, 0x23, 0x06, 0x39, 0x3f, 0xde, 0xcc, 0x9d, 0xe6, 0x6f, 0xe6, 0x72, 0x13, 
-  0x02, 0xa9, 0x6c, 0xd0, 0xab, 0x88, 0xc4, 0xfa, 0x4d, 0xf0, 0x2e, 0x0a, 0x6f, 0x23, 0xc8, 0x27, 
-  0x9d, 0x27, 0xf6, 0xa8, 0x94, 0x75, 0x5f, 0xf1, 0xfb, 0x66, 0xa7, 0xe2, 0xaa, 0x53, 0x23, 0x8d, 
-  0xf2, 0xb5, 0xc2, 0x2f, 0x5c, 0x53, 0x53, 0xb5, 0x91, 0x37, 0x6b, 0x84, 0x62, 0x33, 0x9b, 0x1f, 
-  0xc2, 0x32, 0x47, 0xc5, 0x5b, 0x6a, 0xea, 0x28, 0xbe, 0xf7, 0x90, 0x0f, 0x62, 0x8a, 0x91, 0xda, 
-  0x7a, 0x4a, 0x62, 0xaa, 0x7a, 0xae, 0x4f, 0xd5, 0x21, 0x8e, 0x1c, 0xdd, 0x44, 0x94, 0x7c, 0x1d, 
-  0xf1, 0x56, 0xbe, 0x41, 0x06, 0x82, 0xe4, 0x3d, 0x6f, 0x02, 0x8f, 0x79, 0xc4, 0xf7, 0x7e, 0x83, 
-  0x06, 0x49, 0xa3, 0x69, 0x9a, 0x02, 0xb3, 0x4d, 0x8e, 0x66, 0x36, 0x29, 0xc0, 0x8a, 0x5b, 0x86, 
-  0x1c, 0x98, 0xbf, 0x73, 0xf1, 0xf1, 0x57, 0x64, 0x24, 0x76, 0x88, 0xb9, 0x94, 0xcc, 0x7f, 0xff, 
-  0x6e, 0xe9, 0xbe, 0x03, 0x14, 0x4d, 0x57, 0x11, 0x7e, 0x07, 0xa5, 0x65, 0x5b, 0x78, 0x1a, 0xce, 
-  0xc2, 0x73, 0xef, 0x1b, 0x75, 0x1b, 0xb6, 0xa6, 0x07, 0xd8, 0xcb, 0x42, 0x46, 0xfc, 0xad, 0xbe, 
-  0x11, 0x50, 0x96, 0xa2, 0x86, 0x88, 0x91, 0xf0, 0xf5, 0xec, 0x19, 0x16, 0x02, 0xf1, 0x89, 0x7a, 
-  0x1a, 0xde, 0x07, 0x92, 0x12, 0x65, 0x16, 0x85, 0x0b, 0xe5, 0x67, 0x8f, 0xbd, 0x5e, 0xdd, 0x20, 
-  0xe9, 0xc3, 0x2f, 0x3f, 0xae, 0x2b, 0x81, 0x0b, 0x50, 0x60, 0x8b, 0x1f, 0x52, 0x5e, 0x36, 0x43, 
-  0xe5, 0xc7, 0x75, 0xbc, 0x79, 0xaa, 0x34, 0x7e, 0x5c, 0xfb, 0x9b, 0xbf, 0xbe, 0x54, 0x5a, 0xf0, 
-  0x1e, 0xc0, 0x83, 0xf6, 0xa5, 0x4e, 0x10, 0x33, 0x2f, 0xf0, 0xe2, 0x79, 0x22, 0xc5, 0xf3, 0xe4, 
-  0xed, 0x00, 0x11, 0xc6, 0xab, 0xe9, 0x14, 0xe4, 0xc3, 0xe1, 0xc4, 0xa5, 0x57, 0x45, 0x36, 0xcd, 
-  0x56, 0xfe, 0x13, 0x45, 0xdc, 0x83, 0x51, 0xee, 0x3d, 0xdf, 0x4f, 0x6e, 0xcd, 0xed, 0xc2, 0x46, 
-  0xa3, 0x28, 0x8c, 0x38, 0xae, 0x33, 0x7c, 0x1a, 0x2a, 0x6a, 0x93, 0x98, 0xbc, 0x91, 0x43, 0xb8, 
-  0x9d, 0xf6, 0xac, 0x3d, 0x2b, 0x40, 0x4c, 0x49, 0x30, 0xa5, 0x3e, 0x2e, 0xcf, 0x1c, 0x05, 0x59, 
-  0x63, 0x6a, 0x53, 0x9b, 0xb0, 0xb0, 0x81, 0x4b, 0x21, 0x79, 0xe4, 0xa7, 0x82, 0x26, 0xbf, 0x1d, 
-  0xe9, 0xb0, 0x0d, 0xb7, 0x79, 0x21, 0xda, 0x77, 0xa1, 0xef, 0xbf, 0xc1, 0xeb, 0x78, 0xe0, 0x1c, 
-  0x72, 0x99, 0x00, 0x12, 0x7f, 0x95, 0x0e, 0xe0, 0x6b, 0x77, 0xbd, 0x0d, 0x20, 0xb3, 0x81, 0xe4, 
-  0xb5, 0xb1, 0x3d, 0x02, 0xdc, 0xfb, 0x56, 0x1b, 0xe6, 0x02, 0x29, 0x08, 0xf7, 0xeb, 0x3c, 0x23, 
-  0x60, 0xd1, 0x83, 0xa8, 0x68, 0x81, 0x8f, 0xe2, 0x0a, 0x27, 0x4b, 0xaf, 0x25, 0xb4, 0xd3, 0x4a, 
-  0x97, 0x13, 0x33, 0xc3, 0xaf, 0x90, 0x29, 0x55, 0xad, 0x4d, 0x59, 0x12, 0x2b, 0x4c, 0x56, 0xbb, 
-  0xe8, 0x52, 0xbc, 0xe0, 0x73, 0x66, 0xde, 0x62, 0x75, 0xf1, 0xac, 0x4b, 0xe0, 0xfb, 0xfe, 0xbd, 
-  0xb1, 0x9f, 0x91, 0x0a, 0x1f, 0xa1, 0xa7, 0x26, 0x91, 0x43, 0x86, 0x3b, 0x47, 0x7b, 0x22, 0x5a, 
-  0x07, 0x22, 0x1a, 0xe4, 0x71, 0xd0, 0x0c, 0xfc, 0x41, 0x1a, 0x08, 0x8e, 0x29, 0x0e, 0x41, 0x3f, 
-  0x5c, 0xfb, 0x0d, 0xf5, 0x9c, 0x78, 0x78, 0x4b, 0x93, 0x85, 0xca, 0x6d, 0xea, 0x9b, 0xa4, 0xba, 
-  0x86, 0x90, 0x17, 0x69, 0x9b, 0x8d, 0x5e, 0x95, 0xb0, 0x94, 0xef, 0x11, 0x73, 0xb4, 0x6c, 0xd7, 
-  0xc6, 0x7f, 0xe9, 0x56, 0x30, 0xfa, 0x28, 0xc8, 0xf0, 0x28, 0x5e, 0x7c, 0xa1, 0x31, 0x3f, 0xce, 
-  0x74, 0xe4, 0x8b, 0x29, 0xbe, 0x73, 0xa1, 0xc1, 0x88, 0xb2, 0x1c, 0x34, 0xe9, 0x62, 0xa5, 0x3d, 
-  0x12, 0x1f, 0x0c, 0x16, 0xbf, 0x7a, 0x15, 0x28, 0x89, 0xc4, 0xf1, 0x48, 0xc1, 0x8f, 0xa9, 0xcc, 
-  0xf9, 0x24, 0xc6, 0x8f, 0xd6, 0x27, 0x9c, 0xaf, 0x6b, 0x1f, 0x77, 0x3b, 0x56, 0x77, 0xcc, 0x4c, 
-  0xfc, 0x76, 0x5d, 0x82, 0xeb, 0x1c, 0xef, 0x4f, 0xb3, 0x30, 0x54, 0xf8, 0xe5, 0x08, 0x53, 0xb9, 
-  0x20, 0xdf, 0xbc, 0xc5, 0x6a, 0xa1, 0xe0, 0x18, 0xc5, 0x8b, 0x95, 0xee, 0xc5, 0x4b, 0x89, 0x54, 
-  0x01, 0x1c, 0xdc, 0xaf, 0x47, 0x8b, 0xc6, 0x17, 0xe1, 0x17, 0xc0, 0x03, 0x30, 0x93, 0xd7, 0x68, 
-  0xe8, 0x15, 0x1a, 0x02, 0xf3, 0x96, 0xa3, 0x42, 0x1f, 0x71, 0xf2, 0x45, 0xd3, 0xd6, 0xdb, 0x7a, 
-  0xb5, 0x46, 0x3b, 0x8b, 0x21, 0x2e, 0x2c, 0x28, 0x99, 0x46, 0x42, 0xbe, 0xa2, 0xd2, 0xfb, 0xfb, 
-  0xc5, 0xdb, 0xd7, 0x8c, 0x2d, 0xdf, 0xd3, 0x7f, 0xaf, 0x60, 0xe9, 0x43, 0xbd, 0x27, 0xb4, 0x51, 
-  0x51, 0x06, 0xa4, 0x52, 0xd1, 0x29, 0x58, 0x3d, 0x95, 0x92, 0x7d, 0x15, 0x2e, 0x96, 0x2b, 0x86, 
-  0xf1, 0xf6, 0xd9, 0xb3, 0x2a, 0xa3, 0x5e, 0x27, 0xfa, 0xcf, 0xfc, 0xb8, 0xce, 0xcd, 0x65, 0x88, 
-  0x97, 0x84, 0x24, 0xca, 0xe1, 0x05, 0x61, 0x73, 0x93, 0x7f, 0xc1, 0xae, 0x01, 0x88, 0x61, 0x1c, 
-  0x75, 0x5b, 0x54, 0x78, 0xea, 0x9f, 0x6c, 0x30, 0x19, 0x5d, 0xba, 0xf4, 0x61, 0xd2, 0xab, 0xf3, 
-  0xbe, 0xa1, 0x1c, 0xa3, 0xe7, 0x96, 0xc9, 0xf0, 0x89, 0xb5, 0xc1, 0x52, 0x23, 0xac, 0x60, 0x01, 
-  0x61, 0x55, 0x9d, 0xaf, 0x5a, 0x34, 0x19, 0x59, 0x1e, 0x03, 0x21, 0x6d, 0x0b, 0xbd, 0x7c, 0x98, 
-  0xc4, 0xb2, 0x2a, 0x37, 0x22, 0x4c, 0x01, 0x17, 0xfb, 0x4e, 0x36, 0x85, 0x77, 0x94, 0x2c, 0xfe, 
-  0xef, 0xd5, 0xe5, 0x2f, 0x26, 0x4f, 0xb2, 0x1a, 0x21, 0xac, 0xa2, 0x78, 0x09, 0x82, 0xa7, 0xd7, 
-  0xe0, 0xe2, 0x34, 0x73, 0x01, 0xa4, 0x92, 0x5b, 0xdc, 0x76, 0x90, 0xca, 0x9f, 0xf1, 0xc5, 0x93, 
-  0x93, 0x89, 0x95, 0x32, 0x6d, 0x49, 0x6e, 0xad, 0x22, 0x9f, 0xf6, 0x26, 0xb7, 0x14, 0x0f, 0x27, 
-  0xea, 0x8f, 0x4d, 0x58, 0xe1, 0x4d, 0x36, 0x35, 0xd2, 0x96, 0xb3, 0x72, 0x71, 0xe7, 0x64, 0xfd, 
-  0x5f, 0xa2, 0xb4, 0xca, 0xef, 0x71, 0x42, 0x43, 0x58, 0x0d, 0x0d, 0xf5, 0xdd, 0xe5, 0x15, 0x5e, 
-  0x1b, 0xc8, 0xfb, 0x68, 0x61, 0xa1, 0x2a, 0x8e, 0xc1, 0x8d, 0x63, 0xc8, 0x95, 0x36, 0x1b, 0xbe, 
-  0x54, 0xe5, 0xe2, 0x7e, 0xe7, 0xe3, 0x2f, 0x58, 0xc8, 0x33, 0x02, 0x85, 0x28, 0x89, 0x17, 0x52, 
-  0x84, 0x17, 0xe2, 0xc1, 0x89, 0x7f, 0x2f, 0xe4, 0x9a, 0x97, 0xc4, 0x8e, 0xba, 0x0a, 0xbe, 0x06, 
-  0x10, 0xff, 0xd5, 0x51, 0xc9, 0xe1, 0xe1, 0x34, 0xfc, 0x0b, 0x25, 0x6f, 0x82, 0x59, 0x08, 0xfe, 
-  0xee, 0xa0, 0x08, 0x22, 0xea, 0xec, 0x2c, 0x82, 0xe4, 0x67, 0x4a, 0xe2, 0x06, 0x46, 0x4f, 0x70, 
-  0xd3, 0x3b, 0x3c, 0x67, 0xf6, 0xbd, 0x15, 0x55, 0xd3, 0x00, 0x4b, 0xf1, 0xc8, 0x34, 0x87, 0xf3, 
-  0x10, 0x2f, 0xcf, 0x95, 0xc3, 0x61, 0x14, 0x41, 0x9d, 0xf4, 0xf2, 0x29, 0xa3, 0xf8, 0x75, 0x0c, 
-  0xc2, 0xc4, 0xc5, 0xd5, 0xec, 0x0c, 0x8e, 0x2f, 0xf6, 0x99, 0x1f, 0xe2, 0xfd, 0x8e, 0xd6, 0xa0, 
-  0xdf, 0xc5, 0xf5, 0x4d, 0x0a, 0xad, 0x4f, 0x79, 0x6b, 0xab, 0xd3, 0xc7, 0xae, 0xb0, 0xd8, 0x85, 
-  0x8d, 0xad, 0xbe, 0x85, 0x5c, 0xd2, 0xa7, 0x7d, 0x6b, 0x24, 0xee, 0xfc, 0x29, 0xd6, 0x98, 0x9d, 
-  0xb0, 0xe6, 0x17, 0x74, 0xa2, 0x64, 0x33, 0x87, 0xbf, 0xe1, 0x66, 0xa1, 0xe0, 0xb1, 0x7d, 0xfc, 
-  0x65, 0x68, 0x8d, 0xc9, 0x09, 0x69, 0x7e, 0xd9, 0x6a, 0x0d, 0x4f, 0xc2, 0xe6, 0x97, 0xf4, 0x9d, 
-  0x36, 0xd5, 0x58, 0x2d, 0xc7, 0x26, 0x64, 0xf1, 0x8a, 0xdf, 0xe5, 0x45, 0x83, 0x8d, 0x8b, 0xca, 
-  0xd2, 0x89, 0x1e, 0xea, 0x71, 0x49, 0x65, 0xe2, 0xe6, 0x2f, 0xe8, 0x29, 0x16, 0x7a, 0x4a, 0xa2, 
-  0x7a, 0x2c, 0xa3, 0x3a, 0xe8, 0xb8, 0xbe, 0x16, 0x2f, 0xdc, 0x06, 0x56, 0x51, 0x2c, 0xbb, 0xc7, 
-  0x8a, 0xdb, 0xbf, 0x30, 0x90, 0x81, 0x32, 0x09, 0xcc, 0x26, 0x85, 0x25, 0x5c, 0x29, 0x68, 0x17, 
-  0x91, 0x7d, 0x46, 0x64, 0x90, 0x1c, 0x6b, 0x22, 0x96, 0xe8, 0xac, 0xa0, 0xf3, 0xb0, 0xa9, 0x2a, 
-  0x7f, 0x7d, 0xc9, 0x37, 0xe5, 0x72, 0xad, 0x45, 0xcd, 0x99, 0x62, 0x1e, 0xc4, 0x71, 0xb0, 0x5d, 
-  0x08, 0x39, 0xf0, 0xf0, 0x9f, 0x44, 0xff, 0x0a, 0xd9, 0x16, 0xef, 0x77, 0x97, 0x85, 0x5b, 0x12, 
-  0x6d, 0xe1, 0x5b, 0x16, 0x20, 0xe1, 0xb0, 0x28, 0xe1, 0xf0, 0x00, 0x09, 0x57, 0x7e, 0xaf, 0x64, 
-  0xb7, 0xa0, 0xb7, 0xbf, 0xdb, 0x91, 0x93, 0x37, 0x4b, 0xf7, 0x82, 0x41, 0x0e, 0x72, 0x27, 0x98, 
-  0x48, 0x5f, 0x47, 0xf9, 0x37, 0xc8, 0x0f, 0x16, 0x58, 0xf1, 0x6b, 0x2b, 0xa2, 0xe6, 0xab, 0x16, 
-  0xdc, 0xf6, 0xc5, 0xf8, 0xf5, 0x9e, 0x9b, 0x12, 0x75, 0x6c, 0x1f, 0x2c, 0x29, 0xc1, 0xb6, 0x4c, 
-  0xb4, 0xf6, 0xed, 0xba, 0xa6, 0xc5, 0x38, 0x4d, 0xa4, 0x93, 0x95, 0xe2, 0x24, 0xb7, 0x0b, 0x03, 
-  0x28, 0xc1, 0x18, 0xe5, 0x7e, 0x27, 0xaa, 0xbe, 0xb1, 0x4b, 0xdf, 0x59, 0xa9, 0x2c, 0x7c, 0x77, 
-  0xb2, 0x19, 0xab, 0x81, 0x15, 0x9c, 0x48, 0x17, 0x7d, 0x5a, 0x21, 0xc3, 0x52, 0xdd, 0x3c, 0x4c, 
-  0x52, 0xb5, 0x54, 0xfa, 0xd8, 0x51, 0x29, 0x7d, 0xb5, 0x5e, 0x77, 0x57, 0xdb, 0x30, 0x32, 0x66, 
-  0xe9, 0x34, 0x2d, 0xde, 0x0f, 0x9b, 0x62, 0x4b, 0xbd, 0xb5, 0xdf, 0x43, 0x5b, 0xff, 0xe1, 0x2c, 
-  0x16, 0x02, 0xf0, 0x8e, 0xcb, 0xf8, 0x2d, 0x7e, 0x86, 0xc5, 0xff, 0xb4, 0xbb, 0x46, 0xf6, 0x83, 
-  0x02, 0x2d, 0x3c, 0xac, 0x82, 0xd0, 0x17, 0xb7, 0x5c, 0x59, 0xce, 0xb6, 0x7c, 0x98, 0x2c, 0x66, 
-  0x2d, 0xb5, 0x99, 0x8f, 0x43, 0x4d, 0x15, 0xbf, 0x33, 0x28, 0xcc, 0x24, 0x97, 0xdb, 0x72, 0xc2, 
-  0x72, 0x25, 0xf3, 0xc9, 0x5f, 0xfe, 0x72, 0x3d, 0x87, 0x64, 0x98, 0x17, 0x9c, 0x09, 0x46, 0x85, 
-  0x04, 0x2e, 0x50, 0x0d, 0xb2, 0x81, 0x46, 0x36, 0xa7, 0x8a, 0x98, 0x21, 0x0d, 0xb2, 0x66, 0x96, 
-  0xf2, 0xd6, 0xa4, 0x0e, 0x69, 0x01, 0x5e, 0x91, 0x5f, 0xee, 0x4b, 0x18, 0x2a, 0x72, 0xe9, 0x8d, 
-  0x30, 0x49, 0x11, 0xb2, 0x6a, 0xa3, 0x32, 0x6f, 0xda, 0x32, 0x4d, 0xfc, 0x25, 0x07, 0x1a, 0xc5, 
-  0xc3, 0xb5, 0x2a, 0xfd, 0xa9, 0x71, 0xfd, 0xb0, 0xc4, 0x5b, 0xa1, 0x60, 0xfb, 0x28, 0x53, 0x54, 
-  0x73, 0x0b, 0x9d, 0x95, 0xba, 0x11, 0x66, 0xcc, 0x13, 0xc5, 0x98, 0x6f, 0x36, 0x79, 0x33, 0xe0, 
-  0x69, 0x15, 0xf9, 0x7c, 0x57, 0x1e, 0x1d, 0x53, 0xb1, 0x28, 0xe4, 0xe1, 0xff, 0xa4, 0x2a, 0x41, 
-  0x1d, 0x56, 0x16, 0x95, 0xd5, 0x99, 0x15, 0xc9, 0xe5, 0x9f, 0xe7, 0xc8, 0xc2, 0x7f, 0x2e, 0xc7, 
-  0xda, 0xe1, 0xef, 0xf8, 0x44, 0xb9, 0x65, 0x72, 0x38, 0xbd, 0xf4, 0xcf, 0xa3, 0x77, 0xb3, 0xbd, 
-  0x00, 0x4b, 0xdf, 0x0f, 0x3a, 0x60, 0xd9, 0x6d, 0x2f, 0xb7, 0x7c, 0x7d, 0xa7, 0x4a, 0x3f, 0xad, 
-  0xb8, 0x62, 0xa7, 0x05, 0x92, 0xc2, 0x13, 0x48, 0xbf, 0xea, 0xcc, 0xab, 0xc6, 0xe1, 0x6d, 0xf8, 
-  0xba, 0x42, 0xf5, 0xef, 0x75, 0xf7, 0xe5, 0x3d, 0x3c, 0xba, 0x95, 0xe9, 0xa5, 0x24, 0xe1, 0x2f, 
-  0x60, 0xba, 0x2b, 0x10, 0x25, 0xdf, 0xf2, 0xa1, 0x85, 0x0d, 0x97, 0x74, 0xfb, 0xe7, 0x80, 0xcd, 
-  0x6e, 0xdc, 0x1a, 0xe0, 0xd9, 0x72, 0xb2, 0x55, 0x98, 0x73, 0x7e, 0x72, 0x8a, 0x44, 0xae, 0x6a, 
-  0xba, 0xb0, 0xb6, 0x8c, 0x1b, 0x42, 0x6a, 0x6a, 0x9a, 0x22, 0xb2, 0x27, 0x6f, 0x39, 0xb3, 0xda, 
-  0xf0, 0xf3, 0x1f, 0xa1, 0x00, 0x8c, 0x8e, 0x75, 0xf6, 0x96, 0xb0, 0x18, 0x89, 0xda, 0x56, 0x9a, 
-  0x4c, 0x9d, 0x87, 0x2e, 0x13, 0x09, 0x88, 0xb3, 0xeb, 0x23, 0x7a, 0xf1, 0x06, 0x83, 0x5e, 0xca, 
-  0xe0, 0xf5, 0xad, 0x34, 0x51, 0xdf, 0x4e, 0x6e, 0xf4, 0xfc, 0xf6, 0x51, 0x09, 0x40, 0xb7, 0x69, 
-  0x37, 0xa9, 0xcb, 0xf9, 0x55, 0xeb, 0xcf, 0x78, 0x81, 0xc0, 0xf9, 0xf8, 0xb1, 0x7d, 0x64, 0xe9, 
-  0xf0, 0xdf, 0x27, 0xfd, 0xd1, 0x4f, 0x9f, 0x74, 0x81, 0xe8, 0xcd, 0x1b, 0x89, 0xe6, 0x38, 0xe9, 
-  0x3d, 0xf0, 0x41, 0x22, 0x88, 0x01, 0x9c, 0x37, 0x15, 0xc6, 0xe4, 0x86, 0xda, 0x83, 0x42, 0x0f, 
-  0xbc, 0x0a, 0x68, 0x80, 0x6a, 0xf7, 0x74, 0xf8, 0x0f, 0x7b, 0xab, 0x9e, 0x0a, 0x24, 0x73, 0xd8, 
-  0xe3, 0x14, 0x34, 0x9b, 0x4e, 0xb6, 0x27, 0xa8, 0x05, 0xc4, 0x71, 0x32, 0x2d, 0x36, 0xe1, 0x53, 
-  0x06, 0x93, 0xff, 0x9b, 0x01, 0x48, 0xaa, 0x8a, 0xe4, 0x1d, 0xe5, 0xd0, 0x59, 0x87, 0xd3, 0x56, 
-  0xa2, 0x2a, 0x9b, 0x2a, 0x93, 0x84, 0x78, 0x3a, 0xce, 0x68, 0xdb, 0x12, 0xe0, 0xf1, 0x41, 0x60, 
-  0x5b, 0x74, 0x15, 0x28, 0x2c, 0x49, 0xbe, 0x96, 0xc2, 0xe3, 0x6c, 0xee, 0xc2, 0x0c, 0x95, 0x14, 
-  0xa6, 0x0a, 0xae, 0xd1, 0x6f, 0x02, 0xf2, 0x89, 0x9f, 0xd5, 0xe2, 0xd7, 0xf3, 0x3e, 0xa3, 0x9f, 
-  0xa1, 0x8e, 0xf8, 0xfe, 0x59, 0xf2, 0xf5, 0x33, 0xcd, 0x5c, 0x90, 0x25, 0xf7, 0x15, 0xa2, 0xbd, 
-  0xbf, 0xd5, 0x2e, 0xe9, 0xd5, 0xd2, 0xcd, 0x9d, 0xdf, 0x8b, 0x27, 0x51, 0x16, 0x1e, 0x9c, 0x66, 
-  0x37, 0xbf, 0xf8, 0xcd, 0x86, 0xb8, 0x21, 0x2b, 0x09, 0x6d, 0x9d, 0x73, 0x97, 0xe0, 0x0e, 0xa2, 
-  0x87, 0x2b, 0x5e, 0xc6, 0xa3, 0x9f, 0x90, 0xbf, 0xce, 0xc7, 0x2f, 0x5c, 0x8e, 0x12, 0x0f, 0x08, 
-  0x08, 0xc0, 0xd7, 0x2f, 0xc1, 0x4b, 0x3c, 0x34, 0xd4, 0xfc, 0x4f, 0x4c, 0x42, 0xca, 0xda, 0x54, 
-  0x5d, 0x7a, 0xcb, 0x8f, 0x95, 0x2a, 0xc7, 0x66, 0x3f, 0x2c, 0x09, 0x55, 0xd5, 0x9e, 0xb1, 0xc5, 
-  0xdf, 0xbc, 0x54, 0xf5, 0x10, 0x8b, 0xd0, 0xdc, 0xfd, 0x82, 0x29, 0xf1, 0xa7, 0x2f, 0x02, 0xbc, 
-  0x34, 0xfd, 0xea, 0x57, 0x71, 0xdf, 0x81, 0x39, 0x0d, 0xc8, 0xe0, 0x35, 0xac, 0x83, 0x93, 0xda, 
-  0x97, 0x97, 0x7c, 0xe4, 0x26, 0x6e, 0xb0, 0xb1, 0x63, 0x9d, 0x18, 0x6c, 0x08, 0x7d, 0x06, 0xab, 
-  0xc4, 0x72, 0x10, 0x12, 0xeb, 0x04, 0xda, 0x9b, 0x6c, 0xc8, 0x0a, 0x57, 0xe9, 0x40, 0xa0, 0xfe, 
-  0xec, 0x14, 0x5d, 0x42, 0x43, 0x56, 0xbe, 0xda, 0xba, 0x78, 0xba, 0xdd, 0xe1, 0x87, 0xdb, 0xdc, 
-  0xb3, 0xfb, 0x4e, 0x41, 0xa9, 0x1f, 0x73, 0x25, 0x3c, 0x6b, 0xb5, 0xf1, 0x2e, 0x6d, 0x93, 0x3d, 
-  0x6d, 0xff, 0xd4, 0xf9, 0xa4, 0x07, 0x4e, 0x66, 0x43, 0x3b, 0x86, 0xb9, 0x4e, 0x9e, 0x09, 0xff, 
-  0x23, 0x98, 0x22, 0x1e, 0x9b, 0xc3, 0xa7, 0xa6, 0x47, 0x4e, 0x41, 0x4c, 0xc5, 0xce, 0x69, 0x09, 
-  0xd0, 0x96, 0x7d, 0x36, 0xf4, 0x79, 0x65, 0xc0, 0x7c, 0xe7, 0xca, 0x09, 0x9f, 0x76, 0x7e, 0x42, 
-  0x09, 0x85, 0x63, 0xa7, 0x7d, 0xc2, 0xd1, 0x3a, 0xfc, 0xaf, 0x11, 0x71, 0xc9, 0xe9, 0xbc, 0x05, 
-  0xff, 0x80, 0xc4, 0xf0, 0xa3, 0xe9, 0x40, 0xeb, 0x90, 0x4f, 0x1f, 0x60, 0x17, 0xfe, 0x69, 0x46, 
-  0xcd, 0x95, 0x8e, 0x88, 0x1d, 0x8e, 0xde, 0xf0, 0x12, 0x50, 0x1b, 0x41, 0x6d, 0x01, 0x6a, 0xa7, 
-  0xa0, 0x36, 0x82, 0xda, 0x08, 0x0a, 0x6d, 0x5e, 0x73, 0xa5, 0x0d, 0x61, 0xf2, 0x5e, 0x7e, 0xf2, 
-  0xa6, 0x2b, 0x30, 0xa4, 0x33, 0x18, 0xae, 0x91, 0x9f, 0xa1, 0x39, 0x4d, 0xfa, 0x25, 0x1a, 0x63, 
-  0x6a, 0x08, 0x34, 0x83, 0x93, 0x86, 0x3b, 0x76, 0xa2, 0xbd, 0xc8, 0x20, 0x93, 0xfc, 0xfd, 0xbc, 
-  0x82, 0xc0, 0xc7, 0x8e, 0x77, 0xd2, 0xd8, 0x4b, 0x50, 0xe3, 0x0f, 0x08, 0x85, 0xb3, 0x63, 0xdb, 
-  0x90, 0x21, 0x44, 0x63, 0xc7, 0xfd, 0xb3, 0x19, 0xf2, 0xc6, 0xce, 0xf4, 0xcf, 0x66, 0x48, 0x4f, 
-  0x1d, 0x56, 0xe7, 0x27, 0xd6, 0xa4, 0x9c, 0x04, 0x3e, 0x06, 0x56, 0xd9, 0xa6, 0xb0, 0x0a, 0xc5, 
-  0x0a, 0x4c, 0xdd, 0x5a, 0x61, 0x5d, 0xb6, 0x7f, 0x82, 0x76, 0x33, 0xf6, 0x31, 0x6d, 0xb5, 0xf4, 
-  0x8e, 0xc6, 0x87, 0xe8, 0xe5, 0x21, 0x4d, 0x3b, 0x1d, 0xd4, 0xd1, 0xfb, 0x62, 0x50, 0x61, 0x8a, 
-  0x2b, 0xc8, 0x3d, 0x1a, 0xe5, 0xc5, 0x2d, 0x6e, 0xae, 0xe4, 0x08, 0xc8, 0xf2, 0x14, 0x1d, 0x7f, 
-  0x91, 0xbb, 0xc5, 0xd7, 0xee, 0x32, 0xbc, 0x6f, 0x94, 0xef, 0x1e, 0x9a, 0x47, 0x5a, 0x11, 0xff, 
-  0x5b, 0xf2, 0xdb, 0x03, 0x7e, 0x43, 0xea, 0x90, 0x09, 0xe2, 0x8f, 0xb8, 0xc5, 0x42, 0xa2, 0x17, 
-  0x98, 0xeb, 0x7d, 0x7a, 0xec, 0x4c, 0xe7, 0xab, 0xe0, 0x77, 0x4e, 0x64, 0xeb, 0x76, 0xff, 0x11, 
-  0x13, 0xfd, 0x0a, 0x05, 0x3e, 0xff, 0xd6, 0x97, 0xc8, 0xe1, 0xe4, 0x76, 0x66, 0x0d, 0xe8, 0xe8, 
-  0x20, 0xc9, 0xbe, 0x79, 0x03, 0xdc, 0x0e, 0x5a, 0xa4, 0x3c, 0x7c, 0x90, 0x0c, 0x2f, 0xdc, 0x4b, 
-  0x2a, 0x28, 0x39, 0x87, 0x02, 0xf8, 0x40, 0x1c, 0x1b, 0xbd, 0x71, 0x44, 0x3b, 0xcd, 0xae, 0x65, 
-  0xfd, 0xd4, 0x00, 0x03, 0xd0, 0xb4, 0x6d, 0xbc, 0xdd, 0x3a, 0xbc, 0xbb, 0xc4, 0x64, 0xa1, 0x3e, 
-  0x38, 0x7a, 0xbb, 0x9f, 0xe0, 0xe7, 0x26, 0xc6, 0x67, 0xd8, 0x24, 0xd7, 0xb9, 0x10, 0x65, 0x21, 
-  0x38, 0xf3, 0x9b, 0x5a, 0x15, 0xb7, 0xb2, 0xf1, 0x40, 0x07, 0xfb, 0x92, 0x8b, 0x17, 0x66, 0xbc, 
-  0xba, 0x11, 0x75, 0x31, 0x18, 0x74, 0x4f, 0x33, 0x71, 0x53, 0x82, 0x80, 0xe1, 0x42, 0x2d, 0xad, 
-  0xab, 0x7c, 0xdf, 0xae, 0x21, 0x2f, 0x4e, 0x3f, 0x34, 0xb4, 0x66, 0x5f, 0x7b, 0x7a, 0x84, 0xfb, 
-  0xc2, 0xb9, 0x0b, 0xdc, 0xbc, 0x66, 0x7a, 0xe2, 0x38, 0x09, 0x15, 0xf2, 0x3c, 0x9f, 0x7f, 0x3f, 
-  0x82, 0xe0, 0x57, 0x3a, 0xf0, 0x2c, 0x38, 0xf7, 0x85, 0x1c, 0x79, 0xad, 0x21, 0x19, 0xee, 0xb0, 
-  0xc2, 0xa5, 0x61, 0x71, 0xcb, 0x41, 0xb1, 0x86, 0x89, 0x15, 0x27, 0xe3, 0xb4, 0xdc, 0x79, 0xb7, 
-  0x62, 0x0f, 0xa5, 0xe9, 0x55, 0xf6, 0xb6, 0x87, 0xa9, 0xbd, 0xa4, 0xfd, 0xe2, 0x9c, 0xc1, 0x7e, 
-  0xb2, 0x83, 0xb2, 0xef, 0xdf, 0xd3, 0x95, 0xc9, 0xc5, 0xca, 0xfb, 0xd2, 0xa3, 0xe9, 0xad, 0x2b, 
-  0x71, 0xe9, 0x57, 0x92, 0xd2, 0xaf, 0x75, 0x00, 0xdb, 0x05, 0x18, 0xf0, 0x9e, 0x29, 0x97, 0xf2, 
-  0x96, 0x5d, 0x11, 0x67, 0xbe, 0x5e, 0x91, 0x2a, 0xe3, 0xe7, 0xb7, 0x79, 0xcb, 0xcf, 0xae, 0x39, 
-  0xaf, 0x8b, 0x27, 0xd1, 0x05, 0x54, 0x9a, 0x5e, 0x45, 0x6d, 0xbe, 0xa8, 0x94, 0xbc, 0xe9, 0xb6, 
-  0x65, 0xed, 0x59, 0x75, 0x89, 0x49, 0xbd, 0xaa, 0xe2, 0x7f, 0xc7, 0x2d, 0x46, 0xfe, 0x63, 0xa5, 
-  0x9e, 0xef, 0xb1, 0x07, 0xf1, 0xf3, 0x55, 0xe2, 0x18, 0x53, 0x95, 0xbf, 0x61, 0xaa, 0x3a, 0x59, 
-  0x7a, 0x98, 0x8d, 0xc4, 0xda, 0x8c, 0x9e, 0xa4, 0x37, 0xcc, 0xb7, 0xa6, 0x05, 0x11, 0x1e, 0x28, 
-  0xb2, 0x61, 0x63, 0x9b, 0xe6, 0x02, 0xa8, 0xbe, 0x4b, 0x7c, 0xb8, 0x11, 0x94, 0xd7, 0xe8, 0xb8, 
-  0x25, 0x7f, 0x6a, 0x62, 0xdc, 0x12, 0x3f, 0x13, 0xda, 0xe2, 0xff, 0x63, 0x8f, 0xff, 0x07, 0x64, 
-  0xd1, 0xbf, 0xc7, 0xdf, 0x63, 0x00, 0x00
+const uint8_t WEB_PAGE_HTML[7723] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbd, 0x3d, 0x69, 0x77, 0xdb, 0x38, 
+  0x92, 0xdf, 0xf7, 0x57, 0x30, 0x98, 0xc4, 0x21, 0x22, 0x90, 0x22, 0x75, 0x59, 0xa6, 0x44, 0x7a, 
+  0x13, 0x1f, 0x93, 0xec, 0xc4, 0x9d, 0x6c, 0xec, 0x4c, 0xef, 0x8c, 0x9f, 0x5f, 0x07, 0x16, 0x21, 
+  0x89, 0x13, 0x8a, 0x50, 0x93, 0x90, 0x8f, 0x96, 0xf5, 0xdf, 0xf7, 0x15, 0xc0, 0x5b, 0x87, 0x95, 
+  0xee, 0xe9, 0x79, 0x79, 0x2d, 0x53, 0x00, 0xaa, 0x50, 0x17, 0x0a, 0x55, 0x40, 0x51, 0x3d, 0x9c, 
+  0x8a, 0x59, 0xe8, 0x0d, 0xa7, 0x8c, 0xfa, 0xde, 0x50, 0x04, 0x22, 0x64, 0xde, 0x49, 0xc8, 0x47, 
+  0xdf, 0xe5, 0x87, 0xd6, 0xea, 0x68, 0x7a, 0xcc, 0xe6, 0x61, 0x30, 0xa2, 0x46, 0x34, 0xc1, 0xc3, 
+  0xa6, 0x1a, 0x31, 0x0c, 0x83, 0xe8, 0xbb, 0x16, 0xb3, 0xd0, 0x0d, 0x46, 0x3c, 0xd2, 0xa6, 0x31, 
+  0x1b, 0xbb, 0xc8, 0xa7, 0x82, 0x3a, 0xc1, 0x8c, 0x4e, 0x58, 0x33, 0xb9, 0x9b, 0x34, 0x1e, 0x66, 
+  0x21, 0x79, 0xd5, 0x3e, 0x49, 0xee, 0x26, 0xda, 0xc3, 0x2c, 0x8c, 0x12, 0xf7, 0xf5, 0x54, 0x88, 
+  0xb9, 0xd3, 0x6c, 0xde, 0xdf, 0xdf, 0x9b, 0xf7, 0x6d, 0x93, 0xc7, 0x93, 0x66, 0xcb, 0xb2, 0x2c, 
+  0x18, 0xfc, 0x5a, 0xbb, 0x0b, 0xd8, 0xfd, 0x3b, 0xfe, 0xe0, 0xbe, 0xb6, 0x34, 0x4b, 0xeb, 0x1c, 
+  0xc9, 0xff, 0x5e, 0xbf, 0x6a, 0x9f, 0x01, 0x06, 0xf1, 0x18, 0xb2, 0x3d, 0x70, 0xbc, 0x6a, 0x9f, 
+  0x69, 0xaf, 0x5a, 0xed, 0x31, 0xbd, 0xd3, 0x5e, 0x1d, 0xbe, 0xd3, 0x12, 0x11, 0xf3, 0xef, 0xcc, 
+  0x81, 0x26, 0xcb, 0xb2, 0x06, 0xda, 0x38, 0x08, 0xc3, 0xe2, 0xdb, 0xab, 0xc3, 0x53, 0xed, 0xbf, 
+  0x67, 0xcc, 0x0f, 0xa8, 0xa6, 0xcf, 0x63, 0x36, 0x66, 0x71, 0x62, 0x8c, 0x78, 0xc8, 0x63, 0x23, 
+  0x19, 0x4d, 0xd9, 0x8c, 0x39, 0x9a, 0x4f, 0xe3, 0xef, 0x58, 0x62, 0xda, 0x8c, 0x74, 0x3c, 0x1e, 
+  0x97, 0x90, 0xca, 0x6f, 0x80, 0x54, 0xfe, 0xd7, 0x3e, 0x69, 0x4a, 0xaa, 0x15, 0x03, 0x13, 0x2d, 
+  0xf0, 0xdd, 0xd7, 0x63, 0x7a, 0x97, 0x32, 0x34, 0x51, 0x7f, 0xe6, 0x54, 0x4c, 0x35, 0xdf, 0x7d, 
+  0x7d, 0xd1, 0x6a, 0xb7, 0x4d, 0xcb, 0xea, 0x10, 0xeb, 0xc4, 0xb6, 0x3a, 0x66, 0xab, 0xd5, 0x21, 
+  0x16, 0xb1, 0x88, 0x7c, 0xb6, 0x5b, 0xc4, 0x22, 0x69, 0xff, 0xc8, 0x22, 0x76, 0xab, 0x6f, 0x1e, 
+  0xf6, 0xed, 0xbc, 0x2f, 0x83, 0xac, 0xfd, 0xd5, 0x46, 0x6a, 0x60, 0x09, 0xd8, 0xa8, 0x81, 0x18, 
+  0xe9, 0xdf, 0x93, 0x4e, 0xaf, 0x67, 0x5a, 0x56, 0x5f, 0xa1, 0x6c, 0xb5, 0x48, 0xbb, 0x67, 0x9b, 
+  0x87, 0x47, 0xbd, 0x02, 0x92, 0x58, 0xbf, 0x69, 0x17, 0xad, 0x4e, 0xc7, 0xec, 0xf4, 0x3b, 0xa4, 
+  0xd5, 0x69, 0x99, 0xbd, 0xee, 0x51, 0x68, 0xf4, 0xda, 0x66, 0xd7, 0x6e, 0x91, 0xc3, 0xae, 0xd9, 
+  0xb5, 0x6d, 0x6d, 0x64, 0x74, 0xcd, 0x76, 0xbb, 0x4d, 0x7a, 0x66, 0xbb, 0x63, 0xd8, 0x1d, 0xf3, 
+  0xf0, 0xe8, 0x90, 0x1c, 0x9a, 0x76, 0xb7, 0x67, 0xb4, 0x6c, 0xd3, 0x6e, 0x77, 0x89, 0x6d, 0xf6, 
+  0x5b, 0x9d, 0x91, 0x21, 0xfb, 0xe5, 0x50, 0x03, 0xba, 0x0f, 0xd5, 0xd8, 0xae, 0x21, 0xbb, 0xd3, 
+  0xb1, 0x61, 0xf7, 0xc8, 0x3c, 0x3a, 0xb2, 0x8d, 0x43, 0xdb, 0x6c, 0xb7, 0xba, 0x7f, 0xef, 0xf6, 
+  0x4d, 0xab, 0xd5, 0x1f, 0x59, 0x46, 0xdf, 0x6c, 0xf5, 0x3b, 0xa4, 0x67, 0x1e, 0xda, 0x3d, 0xc3, 
+  0xee, 0x12, 0xbb, 0x6b, 0xd8, 0x5d, 0x2d, 0xb1, 0xbb, 0xaa, 0x89, 0xc8, 0xa6, 0x3b, 0xfb, 0xb0, 
+  0x63, 0x1e, 0x1d, 0xf6, 0xa6, 0xd6, 0x49, 0xab, 0xd3, 0x4f, 0x45, 0xd2, 0x33, 0xbb, 0xed, 0x1e, 
+  0x69, 0x75, 0x7a, 0xe6, 0x61, 0xf7, 0x90, 0xb4, 0xda, 0x47, 0xe6, 0x51, 0x17, 0xbe, 0x57, 0x38, 
+  0xfa, 0xed, 0x75, 0x53, 0x69, 0xa5, 0x39, 0xa9, 0xfd, 0x4d, 0xee, 0xe0, 0x09, 0x89, 0xc7, 0x39, 
+  0x73, 0x2b, 0xd6, 0xed, 0x0d, 0xa5, 0x8e, 0x3d, 0x58, 0x40, 0xcb, 0xfb, 0xc0, 0x17, 0x53, 0xc7, 
+  0xb6, 0xac, 0x57, 0x83, 0x29, 0x0b, 0x26, 0x53, 0x21, 0x9f, 0x57, 0xb7, 0xdc, 0x7f, 0x5c, 0xfa, 
+  0x41, 0x32, 0x0f, 0xe9, 0xa3, 0x33, 0x0e, 0xd9, 0xc3, 0x00, 0x3e, 0x0c, 0x3f, 0x88, 0xd9, 0x48, 
+  0x04, 0x3c, 0x72, 0x46, 0x3c, 0x5c, 0xcc, 0xa2, 0x01, 0x0d, 0x83, 0x49, 0x64, 0x04, 0x82, 0xcd, 
+  0x12, 0x67, 0xc4, 0x22, 0xc1, 0xe2, 0xc1, 0xbf, 0x16, 0x89, 0x08, 0xc6, 0x8f, 0xc6, 0x88, 0x47, 
+  0x82, 0x45, 0x22, 0x6b, 0x1e, 0xf3, 0x48, 0x18, 0x63, 0x3a, 0x0b, 0xc2, 0x47, 0xe7, 0x8a, 0x4e, 
+  0xf9, 0x8c, 0x92, 0xf7, 0x2c, 0xbc, 0x63, 0x22, 0x18, 0x51, 0x92, 0xd0, 0x28, 0x31, 0x12, 0x16, 
+  0x07, 0xe3, 0x81, 0x34, 0x66, 0xe7, 0x2f, 0x60, 0x97, 0xb7, 0x74, 0xf4, 0x7d, 0x12, 0xf3, 0x45, 
+  0xe4, 0x1b, 0x69, 0x6b, 0xcb, 0x86, 0x7f, 0x83, 0xd1, 0x22, 0x4e, 0x78, 0xec, 0xf8, 0x6c, 0x4c, 
+  0x17, 0xa1, 0x18, 0x2c, 0x12, 0x16, 0x1b, 0x09, 0x0b, 0xd9, 0x48, 0x38, 0x11, 0x8f, 0x98, 0x9a, 
+  0x2b, 0x09, 0x7e, 0x63, 0x8e, 0xdd, 0x99, 0x3f, 0xac, 0xfe, 0x42, 0x63, 0xb1, 0x9c, 0xd1, 0x78, 
+  0x12, 0x44, 0x4e, 0xdf, 0x9a, 0x3f, 0x68, 0xd6, 0xca, 0x94, 0xfe, 0x60, 0x59, 0x1a, 0xd8, 0x9b, 
+  0x3f, 0x28, 0xb8, 0x7b, 0x25, 0x86, 0x43, 0xcb, 0x1a, 0x28, 0x18, 0xe3, 0x96, 0x0b, 0xc1, 0x67, 
+  0x4e, 0x7f, 0xfe, 0x30, 0x10, 0xec, 0x41, 0x18, 0x92, 0xe9, 0x94, 0xaf, 0x95, 0x09, 0x4d, 0xcb, 
+  0xbd, 0x46, 0x26, 0x8f, 0x89, 0x60, 0x33, 0x23, 0x11, 0x54, 0x24, 0xcb, 0x94, 0xa3, 0xdb, 0x3e, 
+  0xfc, 0x5b, 0x1f, 0x9d, 0xcd, 0x2d, 0xf8, 0x5c, 0xa2, 0xab, 0x4e, 0x20, 0xa9, 0x0d, 0x83, 0x88, 
+  0x19, 0x99, 0xd2, 0xcc, 0xee, 0x8a, 0x66, 0x38, 0xfb, 0x14, 0xfe, 0x29, 0x9c, 0x3e, 0x1b, 0xf1, 
+  0x98, 0x4a, 0x95, 0x81, 0x68, 0x56, 0xe6, 0x94, 0x86, 0x63, 0xc3, 0x0f, 0x26, 0x81, 0x58, 0x8e, 
+  0x43, 0x4e, 0x85, 0x13, 0xb2, 0xb1, 0x58, 0x99, 0x23, 0x70, 0x9b, 0x4b, 0xc3, 0x48, 0x66, 0x34, 
+  0x0c, 0x8d, 0x29, 0x8d, 0x7c, 0xe7, 0xc8, 0xf2, 0xd9, 0x64, 0x60, 0x18, 0x21, 0x8d, 0x27, 0xac, 
+  0xda, 0x44, 0xa3, 0x60, 0x26, 0x91, 0x1a, 0x22, 0x98, 0x31, 0xc7, 0xee, 0x26, 0x03, 0x65, 0x48, 
+  0xfd, 0xbb, 0xfb, 0xcc, 0x8e, 0xe0, 0xf1, 0x96, 0xc7, 0x3e, 0x8b, 0x8d, 0x98, 0xfa, 0xc1, 0x22, 
+  0x71, 0xba, 0xd6, 0xab, 0xc1, 0x2d, 0x7f, 0x30, 0x92, 0x29, 0xf5, 0xf9, 0xbd, 0x13, 0x44, 0x09, 
+  0x13, 0x1a, 0xf8, 0xcd, 0xf6, 0xfc, 0x41, 0x93, 0x1a, 0x2f, 0x28, 0xca, 0x74, 0x3c, 0xe7, 0x81, 
+  0x14, 0xc7, 0x9c, 0x27, 0x81, 0xe4, 0x82, 0xde, 0x26, 0x3c, 0x5c, 0x08, 0x96, 0x92, 0xec, 0x44, 
+  0x62, 0x6a, 0xf0, 0xb1, 0x01, 0x66, 0xae, 0x47, 0x0d, 0x1b, 0x2f, 0x47, 0x21, 0xa3, 0x71, 0x99, 
+  0x2b, 0xc5, 0xc0, 0x7b, 0x1a, 0xf9, 0x24, 0x6d, 0x90, 0x4c, 0x42, 0xc3, 0x52, 0xc4, 0x34, 0x4a, 
+  0xc6, 0x3c, 0x9e, 0x19, 0x3c, 0x0e, 0xc0, 0x3e, 0xba, 0x60, 0x1f, 0xa9, 0x0a, 0x64, 0x67, 0x90, 
+  0xb1, 0x19, 0x44, 0x13, 0x63, 0xbc, 0x88, 0x94, 0xf9, 0x33, 0x9a, 0xb0, 0x52, 0xbf, 0x93, 0xe3, 
+  0xd1, 0xee, 0x68, 0xac, 0xd7, 0x05, 0x84, 0x57, 0xdb, 0x27, 0x76, 0x62, 0x2e, 0xa8, 0x60, 0xff, 
+  0xd4, 0x15, 0x60, 0x21, 0x7f, 0x8c, 0xd7, 0xe8, 0xdf, 0x0a, 0x55, 0xa8, 0x08, 0xa0, 0xa6, 0x81, 
+  0xef, 0xb3, 0x48, 0x33, 0x6f, 0x45, 0x64, 0x28, 0xbd, 0x66, 0x2b, 0x59, 0x9a, 0xc0, 0x5f, 0xd8, 
+  0x83, 0x60, 0x71, 0x44, 0xc3, 0x74, 0x60, 0xb5, 0xb7, 0x04, 0xb5, 0x26, 0xf3, 0x54, 0xc9, 0x9d, 
+  0x42, 0xc9, 0xf0, 0xb8, 0x6d, 0x99, 0xfa, 0xa3, 0xe7, 0xb4, 0x9d, 0xaf, 0x3e, 0x13, 0x8c, 0xa5, 
+  0xbe, 0xfa, 0x76, 0xb9, 0x9f, 0x98, 0xdf, 0xa7, 0xbe, 0xa7, 0xe6, 0x66, 0xb6, 0x78, 0x9f, 0x0d, 
+  0x7e, 0xaa, 0x6a, 0x60, 0x25, 0xbe, 0x9d, 0x29, 0xbf, 0x63, 0xf1, 0x72, 0x9d, 0xad, 0x51, 0xcf, 
+  0xa2, 0x16, 0x2d, 0x8d, 0x2c, 0x9e, 0x0c, 0x11, 0x2e, 0xab, 0xc6, 0xde, 0xb9, 0xbb, 0x97, 0xdc, 
+  0x5a, 0x5b, 0xc6, 0xc7, 0x99, 0xcf, 0x00, 0x4b, 0x55, 0x72, 0xac, 0xc0, 0x5b, 0x5a, 0x8a, 0x61, 
+  0x33, 0xfc, 0x6d, 0xb8, 0x2c, 0x79, 0x88, 0x4d, 0xe0, 0x32, 0x20, 0xb9, 0xbb, 0xdf, 0x02, 0xbe, 
+  0x3e, 0xfd, 0xb3, 0xe8, 0x24, 0x3d, 0x99, 0x4d, 0xde, 0xf2, 0x87, 0xe5, 0xc6, 0x25, 0x9f, 0xfa, 
+  0x59, 0xb3, 0x95, 0x4e, 0x9d, 0x8e, 0x3a, 0x6c, 0xcd, 0x1f, 0x72, 0xa3, 0x29, 0x1c, 0x9a, 0xd3, 
+  0x59, 0xf3, 0x6d, 0xfd, 0xcc, 0x11, 0xe7, 0x0e, 0x3c, 0xa3, 0x45, 0x61, 0xb2, 0x06, 0x73, 0xea, 
+  0xfb, 0x41, 0x34, 0x71, 0xac, 0x75, 0xd3, 0x93, 0x0b, 0x64, 0x4e, 0x63, 0x16, 0x89, 0xca, 0x4e, 
+  0xb2, 0xc9, 0x0e, 0x5b, 0x60, 0x87, 0xfe, 0x18, 0xfe, 0xd5, 0xbd, 0xcd, 0xbf, 0x77, 0xe7, 0x2b, 
+  0xb9, 0xd9, 0x5b, 0x11, 0x6d, 0x35, 0xaf, 0xdb, 0x0e, 0xfc, 0xeb, 0xdc, 0xca, 0x51, 0x26, 0x1d, 
+  0x89, 0xe0, 0x8e, 0x6d, 0x18, 0x96, 0x52, 0xbc, 0x91, 0xa5, 0x1a, 0x53, 0x0a, 0xc0, 0xb2, 0x94, 
+  0x0d, 0x99, 0x3e, 0x7d, 0x34, 0xfe, 0xad, 0x68, 0x33, 0x4d, 0x94, 0x55, 0x57, 0x55, 0x26, 0xd8, 
+  0xcb, 0x94, 0x8d, 0xbe, 0x17, 0xe6, 0xd2, 0xe9, 0x14, 0x86, 0x20, 0xb7, 0xb1, 0x8d, 0x33, 0xda, 
+  0x30, 0x1f, 0xcc, 0x50, 0xda, 0x11, 0x52, 0x8b, 0x69, 0x6d, 0xb2, 0x98, 0x62, 0x9a, 0x67, 0xc4, 
+  0x5b, 0x0c, 0x34, 0x55, 0xc4, 0xc0, 0xfc, 0x0d, 0x63, 0xa5, 0xc8, 0xa6, 0x7c, 0x11, 0x1b, 0x72, 
+  0x77, 0x4f, 0x29, 0xef, 0xd7, 0x28, 0xaf, 0x7b, 0xbb, 0x3f, 0xc9, 0x6a, 0xca, 0xab, 0xa1, 0xc4, 
+  0xbc, 0x5c, 0xa8, 0xc0, 0x79, 0x32, 0xa7, 0x23, 0x16, 0x2f, 0x53, 0xca, 0x5a, 0xb2, 0x2d, 0x88, 
+  0xe6, 0x0b, 0x51, 0x26, 0xde, 0xde, 0xb5, 0x00, 0x9f, 0x5d, 0x1e, 0x3b, 0xd7, 0x59, 0xba, 0x3a, 
+  0x77, 0x2e, 0xc0, 0xcc, 0x50, 0x80, 0xe8, 0x35, 0xb3, 0x29, 0x1a, 0xa4, 0x33, 0x92, 0xb2, 0xcd, 
+  0x5a, 0xe2, 0x42, 0xdc, 0xf5, 0x60, 0xad, 0x10, 0x50, 0x26, 0xf8, 0x20, 0x82, 0x98, 0x68, 0x70, 
+  0x3f, 0x0d, 0x04, 0x33, 0xa4, 0x58, 0x9c, 0x88, 0xdf, 0xc7, 0x74, 0x5e, 0xf3, 0x20, 0x65, 0xf9, 
+  0x38, 0x63, 0x3e, 0x5a, 0x24, 0xc6, 0x5d, 0x90, 0x04, 0xb7, 0x21, 0x5b, 0xf2, 0x85, 0x00, 0x1c, 
+  0x65, 0x3e, 0x2a, 0xa3, 0x1d, 0x65, 0x35, 0x01, 0x8f, 0x96, 0xa5, 0x75, 0x50, 0xc8, 0x47, 0xb2, 
+  0xbb, 0x52, 0x83, 0xca, 0x5a, 0xd8, 0x1e, 0xcb, 0xae, 0x09, 0xc9, 0xb1, 0x34, 0xd0, 0x4f, 0x6d, 
+  0x7f, 0x5a, 0x43, 0xa9, 0xf1, 0xb9, 0x24, 0x63, 0x0f, 0xcc, 0xca, 0x96, 0x13, 0xe9, 0xb4, 0xb7, 
+  0xae, 0xfc, 0xdf, 0x67, 0xbd, 0x19, 0xcd, 0xa0, 0x92, 0xd5, 0x50, 0x65, 0x8f, 0xde, 0xb0, 0xa9, 
+  0xd2, 0x72, 0xc8, 0x22, 0x20, 0x87, 0x84, 0xbf, 0xde, 0xd0, 0x0f, 0xee, 0xb4, 0x51, 0x48, 0x93, 
+  0xc4, 0x55, 0x16, 0xeb, 0x0d, 0x9b, 0x7e, 0x70, 0xe7, 0x0d, 0xa7, 0xf6, 0xce, 0xcc, 0x7d, 0x6a, 
+  0x2b, 0xd0, 0xc0, 0x77, 0x69, 0x2c, 0x32, 0xa0, 0x6d, 0xc8, 0x8a, 0x76, 0x95, 0xf1, 0x5f, 0x70, 
+  0x9f, 0x95, 0xba, 0x02, 0xdf, 0x9d, 0x71, 0x9f, 0x25, 0x3f, 0x8a, 0xe6, 0x72, 0xce, 0x98, 0xaf, 
+  0x5d, 0x2c, 0x42, 0x11, 0xcc, 0xc3, 0x80, 0xc5, 0xc5, 0x30, 0x6f, 0x28, 0x55, 0xa2, 0xc9, 0x3c, 
+  0x2b, 0x5a, 0xcc, 0x6e, 0x59, 0x2c, 0x67, 0xc9, 0x87, 0x6a, 0x52, 0x26, 0x6e, 0x9e, 0x68, 0x41, 
+  0x7c, 0x29, 0x31, 0x97, 0x54, 0x39, 0x0b, 0x22, 0xd7, 0xf6, 0xb4, 0xe1, 0xed, 0x42, 0x08, 0x1e, 
+  0xa5, 0xfd, 0xb7, 0x22, 0xda, 0x00, 0xcb, 0xa3, 0x51, 0x18, 0x8c, 0xbe, 0xbb, 0x09, 0xbd, 0x63, 
+  0x52, 0x62, 0x97, 0x4c, 0x88, 0x20, 0x9a, 0x24, 0x3a, 0xf6, 0x2e, 0xdf, 0xfe, 0xfd, 0x6c, 0xd8, 
+  0x54, 0x48, 0x7e, 0x98, 0xc3, 0x90, 0xb1, 0xb9, 0x76, 0x15, 0xcc, 0x6a, 0xe2, 0xf2, 0xe9, 0x63, 
+  0x45, 0x5a, 0x81, 0xef, 0x4a, 0x63, 0xfa, 0x51, 0xfc, 0x3f, 0x07, 0x31, 0x0b, 0x59, 0x92, 0x68, 
+  0x27, 0x3c, 0x8a, 0x94, 0x59, 0x55, 0xb1, 0xde, 0x07, 0xe3, 0xa0, 0x0c, 0xb6, 0xc6, 0xbe, 0x0c, 
+  0xcd, 0x03, 0xdf, 0x1d, 0xf1, 0xc8, 0xb0, 0x0a, 0x39, 0xc8, 0x75, 0x51, 0x20, 0xd5, 0x2d, 0xec, 
+  0xbd, 0xff, 0x74, 0x75, 0xf9, 0xf9, 0xd3, 0xd5, 0x1a, 0x25, 0x3b, 0x51, 0xda, 0xdb, 0x51, 0xda, 
+  0xd8, 0x3b, 0xfb, 0xbf, 0xab, 0xb3, 0x2f, 0x3f, 0xbd, 0xfd, 0x98, 0xe2, 0x54, 0x9f, 0x32, 0xe0, 
+  0x0f, 0x7c, 0x37, 0x0b, 0xa8, 0xd3, 0x69, 0xd2, 0xf8, 0x9b, 0x47, 0xc9, 0xe2, 0x76, 0x16, 0x08, 
+  0x37, 0x66, 0x62, 0x11, 0x47, 0x2f, 0xec, 0xcc, 0x54, 0xa4, 0x08, 0x13, 0x11, 0xd1, 0x19, 0x5b, 
+  0x37, 0x85, 0x79, 0x48, 0x47, 0x6c, 0xca, 0x43, 0x9f, 0xc5, 0xee, 0xfb, 0x4f, 0x97, 0x57, 0x3f, 
+  0xbd, 0xbd, 0x38, 0xf3, 0xb4, 0x02, 0x32, 0x49, 0x02, 0x7f, 0x37, 0xd4, 0xe5, 0xe5, 0x87, 0x53, 
+  0xb0, 0xa8, 0x90, 0x45, 0x13, 0x31, 0x75, 0x6d, 0x2d, 0x66, 0xbf, 0x2e, 0x82, 0x98, 0xf9, 0x39, 
+  0x1a, 0x69, 0xab, 0x73, 0x9a, 0x24, 0xf7, 0x3c, 0xf6, 0x01, 0x69, 0xfe, 0xbc, 0x13, 0xf1, 0xe7, 
+  0xb7, 0x97, 0x97, 0x3f, 0x7f, 0xfa, 0xb2, 0x15, 0x79, 0x6a, 0xbd, 0x12, 0xbb, 0x62, 0x7d, 0x7f, 
+  0x4b, 0x2e, 0x84, 0xbd, 0x66, 0xc6, 0x20, 0xe5, 0x1f, 0x58, 0xf0, 0xff, 0x7b, 0x75, 0x05, 0x36, 
+  0x36, 0x0e, 0x26, 0x0b, 0x95, 0xf8, 0xd6, 0x94, 0x35, 0xfb, 0x55, 0x08, 0x43, 0x7e, 0xd9, 0xa0, 
+  0x20, 0xc0, 0xa6, 0x28, 0xad, 0xb8, 0xc3, 0x0d, 0x8e, 0xaf, 0xd8, 0x3e, 0x2b, 0x1e, 0x20, 0x8b, 
+  0x2e, 0xf2, 0x99, 0x58, 0x44, 0x6f, 0x43, 0xe6, 0xa7, 0x58, 0x91, 0x12, 0x40, 0xcb, 0x2a, 0x36, 
+  0x63, 0xf9, 0x9c, 0x62, 0x93, 0x9e, 0x1f, 0x76, 0xdf, 0x9a, 0xf7, 0x47, 0x9e, 0x36, 0x0c, 0xe9, 
+  0x2d, 0x0b, 0xb5, 0x31, 0x8f, 0x37, 0xe1, 0xad, 0x0e, 0xf7, 0xce, 0x64, 0xa7, 0x06, 0xb2, 0x18, 
+  0x36, 0x25, 0x60, 0x26, 0xae, 0xdc, 0x8e, 0x24, 0x92, 0x5b, 0x38, 0x15, 0x8c, 0x77, 0x6b, 0x1d, 
+  0xbd, 0xfb, 0xf2, 0xe9, 0x6f, 0x67, 0x5f, 0xb4, 0xb7, 0xa7, 0xa7, 0x5f, 0xce, 0x2e, 0x2f, 0x51, 
+  0xd5, 0x8a, 0x4a, 0x1e, 0x0f, 0x10, 0xce, 0x79, 0x2c, 0x9e, 0x31, 0xa2, 0x4f, 0x5f, 0xae, 0xb4, 
+  0x3b, 0x1a, 0x2e, 0x98, 0x6b, 0xf7, 0xfb, 0x6d, 0xe5, 0xfa, 0xb4, 0x19, 0x7d, 0x70, 0x7b, 0xdd, 
+  0x6e, 0xbb, 0x5b, 0x36, 0x75, 0x89, 0x11, 0x0e, 0x77, 0x9e, 0x5f, 0x29, 0xe8, 0xeb, 0x25, 0x2c, 
+  0xcf, 0x8b, 0x33, 0x4d, 0x57, 0xdb, 0x22, 0x0d, 0x31, 0xda, 0x6e, 0xef, 0x8a, 0xd6, 0xbd, 0x8c, 
+  0x1e, 0xe5, 0x56, 0x5f, 0xc5, 0xfc, 0x07, 0x8c, 0xfd, 0xe2, 0x57, 0x21, 0x94, 0x85, 0xfe, 0x51, 
+  0x63, 0x3f, 0x0f, 0xe2, 0xd9, 0x3d, 0x8d, 0x99, 0xf6, 0x75, 0xee, 0x53, 0x51, 0xf6, 0xdc, 0x8a, 
+  0x82, 0xb5, 0x38, 0xd9, 0x1b, 0xce, 0xbd, 0x77, 0x9c, 0xc6, 0xbe, 0xa3, 0x0d, 0x93, 0x39, 0x8d, 
+  0xd4, 0xee, 0x4c, 0x63, 0xdf, 0x00, 0x19, 0x7b, 0x1f, 0x39, 0x85, 0xdd, 0xdc, 0x34, 0xcd, 0x61, 
+  0x13, 0xba, 0xbd, 0x61, 0x73, 0xee, 0x3d, 0x83, 0x55, 0xc6, 0xa4, 0x95, 0xd5, 0xb2, 0x39, 0xa2, 
+  0x2d, 0x56, 0xe0, 0x62, 0x1e, 0x72, 0xea, 0x6f, 0x59, 0x83, 0x1a, 0x8b, 0x46, 0x52, 0xa8, 0x6a, 
+  0x07, 0xa5, 0xb1, 0x90, 0x32, 0x31, 0xe0, 0x94, 0xbe, 0x32, 0xbf, 0x63, 0x55, 0x16, 0xde, 0x38, 
+  0x08, 0x19, 0x20, 0x1f, 0xa7, 0x22, 0x31, 0x64, 0x03, 0x1d, 0x8d, 0xd8, 0x5c, 0xb8, 0xe6, 0x6d, 
+  0x10, 0xd5, 0xd6, 0x35, 0x1c, 0x76, 0x80, 0x56, 0xa6, 0x34, 0x9a, 0xb0, 0x94, 0xa4, 0x4c, 0x9c, 
+  0x3a, 0xae, 0x29, 0x78, 0xf7, 0xbe, 0xdc, 0x2d, 0x2b, 0xf8, 0xb5, 0xcf, 0x47, 0x8b, 0x19, 0x8b, 
+  0x84, 0x39, 0x61, 0xe2, 0x2c, 0x64, 0xf0, 0xf8, 0xee, 0xf1, 0x83, 0xaf, 0xa3, 0x0a, 0x65, 0x08, 
+  0x9b, 0x72, 0xbc, 0x8e, 0x5f, 0x7b, 0x5f, 0x3f, 0x7f, 0xfc, 0xf4, 0xf6, 0x54, 0x3b, 0xff, 0xf0, 
+  0x71, 0xdd, 0x12, 0x7e, 0x27, 0x15, 0x63, 0x26, 0x46, 0xd3, 0x8c, 0x9d, 0xf3, 0x98, 0xcf, 0xfe, 
+  0x1a, 0x88, 0xe9, 0xe2, 0x56, 0xc7, 0xde, 0xd7, 0xcf, 0xa7, 0x6f, 0xaf, 0xce, 0xb4, 0xf3, 0x2f, 
+  0x9f, 0x2e, 0xb4, 0xbf, 0x7e, 0xb8, 0x7a, 0xff, 0xf5, 0xdd, 0xa6, 0x88, 0x61, 0x9b, 0xa2, 0xbd, 
+  0xe1, 0x5c, 0x69, 0x10, 0xcc, 0x4d, 0x9e, 0x64, 0x2e, 0x92, 0x9a, 0x56, 0xb2, 0xb8, 0xb3, 0xdf, 
+  0xef, 0xd7, 0xcd, 0x67, 0x1f, 0x93, 0x3e, 0xa5, 0x41, 0xf8, 0xa8, 0x7d, 0x61, 0x89, 0xa0, 0xb1, 
+  0xd8, 0x42, 0x91, 0xb2, 0xb9, 0xb5, 0x33, 0xd3, 0x67, 0x2c, 0x7f, 0x8b, 0x97, 0xf6, 0x61, 0x42, 
+  0x23, 0x56, 0x13, 0xfe, 0x19, 0xee, 0x7a, 0xd7, 0x04, 0x9b, 0xfd, 0x36, 0x5d, 0x08, 0x0e, 0xc7, 
+  0x87, 0x23, 0x4d, 0xc2, 0x6a, 0x29, 0xac, 0x46, 0x45, 0xcd, 0x9b, 0x6f, 0xd9, 0xae, 0xf6, 0x3f, 
+  0x04, 0x9b, 0xd0, 0xb9, 0x12, 0x8e, 0x8a, 0x79, 0xd6, 0xe5, 0x01, 0xb1, 0xde, 0xba, 0x83, 0x2c, 
+  0x1b, 0x1e, 0x9c, 0xa8, 0x7b, 0x43, 0xe5, 0x1b, 0x53, 0xc7, 0x6e, 0x79, 0x96, 0xe5, 0x58, 0xd6, 
+  0xb0, 0xa9, 0x5a, 0x6b, 0xbd, 0xb6, 0x67, 0xd9, 0xdb, 0x7b, 0x5b, 0x9e, 0xd5, 0xda, 0xde, 0xdb, 
+  0xf6, 0xac, 0xf6, 0xf6, 0xde, 0x8e, 0x67, 0x75, 0xb6, 0xf7, 0x76, 0x3d, 0xab, 0xbb, 0xbd, 0xb7, 
+  0xe7, 0x59, 0xbd, 0xed, 0xbd, 0x87, 0x9e, 0x75, 0xb8, 0xbd, 0xb7, 0xef, 0x59, 0xfd, 0xed, 0xbd, 
+  0x47, 0x9e, 0x75, 0xb4, 0x43, 0x1a, 0x96, 0x67, 0xef, 0x12, 0x96, 0xed, 0xd9, 0x3b, 0xa4, 0x65, 
+  0xb7, 0x3c, 0x7b, 0x87, 0xb8, 0xec, 0xb6, 0x67, 0xef, 0x90, 0x97, 0xdd, 0xf1, 0xec, 0x1d, 0x02, 
+  0xb3, 0xbb, 0x9e, 0xbd, 0x43, 0x62, 0x76, 0xcf, 0xb3, 0x77, 0x88, 0xcc, 0x3e, 0xf4, 0xec, 0x1d, 
+  0x32, 0xb3, 0xfb, 0x9e, 0xbd, 0x43, 0x68, 0xf6, 0x91, 0x67, 0xef, 0x90, 0x5a, 0xcb, 0xf2, 0x5a, 
+  0x3b, 0xa4, 0xd6, 0xb2, 0xbd, 0xd6, 0x2e, 0x1b, 0x6b, 0x79, 0xad, 0x1d, 0x52, 0x6b, 0xb5, 0xbd, 
+  0x56, 0x55, 0x6a, 0x4d, 0xb5, 0x3c, 0x7e, 0x68, 0x57, 0x58, 0xdb, 0xf6, 0xa5, 0x67, 0x4b, 0x1d, 
+  0x5b, 0x7d, 0xe3, 0xff, 0xdd, 0xdb, 0x4d, 0xba, 0x4e, 0x4f, 0xd9, 0x5d, 0x30, 0x82, 0x7d, 0xeb, 
+  0xcb, 0xd9, 0xe5, 0xd5, 0xdb, 0x2f, 0x57, 0xda, 0x4f, 0x9f, 0x7e, 0xae, 0xfb, 0xf5, 0xe7, 0xfd, 
+  0x30, 0xa4, 0x17, 0xa5, 0x3b, 0xaa, 0x6c, 0x5c, 0xa9, 0xc9, 0x1b, 0xca, 0x0b, 0x0a, 0xef, 0x3c, 
+  0x66, 0x4c, 0x7b, 0xcf, 0xe8, 0xbc, 0x14, 0x47, 0xc0, 0x00, 0x63, 0x1c, 0x33, 0xb8, 0x94, 0xa2, 
+  0x73, 0xcf, 0x30, 0xf2, 0x18, 0x42, 0xc1, 0x0c, 0x6f, 0xe3, 0x0c, 0xfc, 0xeb, 0x5c, 0xde, 0x1b, 
+  0xd5, 0x60, 0x17, 0xb2, 0x75, 0x03, 0xe0, 0xde, 0x3b, 0x08, 0x7b, 0x10, 0x10, 0xe1, 0xa4, 0xb3, 
+  0x9c, 0xc8, 0xdc, 0xbf, 0x34, 0x39, 0x55, 0x37, 0xfe, 0x70, 0x17, 0x9f, 0x38, 0xcd, 0xe6, 0x44, 
+  0xee, 0x89, 0xe6, 0x88, 0xcf, 0x9a, 0x77, 0x34, 0x0c, 0x69, 0x32, 0xf2, 0xfe, 0x1a, 0xd0, 0x11, 
+  0x9f, 0x71, 0xed, 0xef, 0x34, 0x0c, 0x79, 0x4c, 0xa3, 0x60, 0xd8, 0xa4, 0xcf, 0xc1, 0xde, 0x4f, 
+  0x79, 0x32, 0xa3, 0x42, 0x78, 0xd9, 0x83, 0x84, 0x81, 0x9d, 0xaf, 0xa0, 0x44, 0x1e, 0x6d, 0xe4, 
+  0x97, 0x42, 0xbb, 0x88, 0x9a, 0xd1, 0x68, 0x61, 0x46, 0x41, 0xf4, 0x2f, 0xda, 0xd4, 0xbc, 0x0b, 
+  0x1a, 0x2d, 0x58, 0xa8, 0xfd, 0x1c, 0xb0, 0x04, 0xce, 0x1c, 0xea, 0x68, 0x4f, 0x59, 0x12, 0x4c, 
+  0xb6, 0x62, 0x4b, 0xcb, 0x0d, 0xa6, 0x8b, 0x19, 0x8d, 0x92, 0x24, 0x88, 0x46, 0xcc, 0x3e, 0xea, 
+  0xb7, 0x24, 0xc9, 0x9a, 0xf7, 0x5e, 0xb6, 0x6a, 0xb2, 0x59, 0x83, 0xf6, 0x1c, 0xbb, 0x12, 0x6a, 
+  0x32, 0x8a, 0x83, 0xb9, 0xf0, 0x42, 0x26, 0xb4, 0x04, 0x4e, 0x06, 0xdc, 0xeb, 0xb7, 0x71, 0x4c, 
+  0x1f, 0xf5, 0x56, 0x07, 0x9b, 0x50, 0x3c, 0xa0, 0x5b, 0x98, 0xfc, 0x07, 0x5b, 0x6e, 0x48, 0x76, 
+  0x5a, 0x0b, 0x07, 0x3a, 0xae, 0x45, 0xe4, 0x2d, 0x84, 0xda, 0x2e, 0x7d, 0xf7, 0x85, 0x95, 0x77, 
+  0x4b, 0x49, 0xbb, 0x77, 0x3c, 0xf0, 0xb5, 0xa2, 0xf1, 0x94, 0x3e, 0xd6, 0x9b, 0x8a, 0x84, 0x33, 
+  0xef, 0x81, 0x23, 0x9e, 0xe2, 0x84, 0xc7, 0xb5, 0x09, 0xa4, 0xda, 0x2e, 0x42, 0x24, 0x4b, 0x14, 
+  0xe0, 0x39, 0x4b, 0xdc, 0xe1, 0x19, 0xb2, 0x88, 0x9c, 0x04, 0x5b, 0x7e, 0x7d, 0x27, 0x13, 0xaa, 
+  0xac, 0xf3, 0x33, 0x8f, 0x85, 0xcc, 0x72, 0xe4, 0xb7, 0xaf, 0x69, 0x26, 0x93, 0xf7, 0x16, 0x68, 
+  0x07, 0xd9, 0xc5, 0xa2, 0x26, 0xf9, 0xd2, 0x19, 0x5e, 0xaa, 0x78, 0xf8, 0x5b, 0xb6, 0x2e, 0x91, 
+  0xba, 0x76, 0x79, 0xb9, 0x64, 0x2b, 0x94, 0x5a, 0x3b, 0xca, 0x6f, 0x62, 0x34, 0x75, 0xe2, 0x80, 
+  0xbc, 0x21, 0x54, 0xad, 0x94, 0x7b, 0x15, 0x3e, 0x23, 0x85, 0x93, 0x0e, 0xc4, 0x45, 0xb6, 0x65, 
+  0x21, 0x4d, 0x85, 0x33, 0xe9, 0x97, 0xac, 0x8a, 0x05, 0xc9, 0xb3, 0x77, 0x4b, 0xfe, 0x87, 0x72, 
+  0x1f, 0x83, 0xd2, 0x03, 0x11, 0x49, 0x1a, 0x60, 0xc2, 0xc8, 0x1b, 0xca, 0x2a, 0x90, 0x0a, 0x21, 
+  0xf9, 0xe5, 0x26, 0xd2, 0x7c, 0x17, 0x5d, 0x74, 0x2d, 0xd2, 0x39, 0xd4, 0x4e, 0x3a, 0x7d, 0xb3, 
+  0xdd, 0x69, 0xdb, 0x9d, 0x6e, 0x1f, 0xbe, 0x76, 0x0e, 0x49, 0xd1, 0x00, 0xdf, 0xba, 0x96, 0x76, 
+  0x02, 0x7f, 0x6c, 0xb3, 0xd7, 0xed, 0xf5, 0xbb, 0x9d, 0x96, 0x56, 0x02, 0xe8, 0xb6, 0xb5, 0xae, 
+  0x05, 0x9f, 0x1f, 0x8f, 0xba, 0xd9, 0x9f, 0xce, 0xa1, 0xf6, 0x51, 0xa1, 0xfe, 0x27, 0x4a, 0xcb, 
+  0x5a, 0x5c, 0x04, 0xc1, 0x3c, 0x92, 0x45, 0x2d, 0x2e, 0xfa, 0xcb, 0xf9, 0xf9, 0xb9, 0x7a, 0x36, 
+  0xe2, 0x05, 0xc4, 0x70, 0xec, 0x8e, 0x45, 0xdc, 0xf7, 0x11, 0x98, 0x37, 0x15, 0xd3, 0x4d, 0xa4, 
+  0xe7, 0x37, 0xac, 0x7f, 0x02, 0xe9, 0xb6, 0x55, 0xfc, 0xfd, 0x37, 0x10, 0x0f, 0x55, 0x1c, 0x65, 
+  0x9f, 0x87, 0xf2, 0x4b, 0x3d, 0xad, 0x7c, 0x1b, 0x59, 0xd2, 0x1e, 0xf5, 0x21, 0x1e, 0x04, 0xee, 
+  0xa4, 0xf2, 0x88, 0x66, 0x11, 0xcd, 0xc6, 0xc8, 0x7b, 0xdf, 0x58, 0x73, 0xa0, 0x9b, 0x91, 0xc5, 
+  0xbb, 0x90, 0xd9, 0x44, 0xb3, 0x30, 0xf2, 0x2e, 0xf6, 0x44, 0x76, 0xfb, 0x1c, 0x65, 0x86, 0x24, 
+  0xcd, 0xd8, 0x13, 0xdb, 0x4e, 0xd2, 0x8c, 0x8c, 0x36, 0xa3, 0xbc, 0x03, 0x7e, 0x5b, 0xe5, 0x8b, 
+  0x6d, 0xc2, 0x22, 0x70, 0x27, 0x89, 0x8e, 0x97, 0x77, 0x34, 0xd6, 0xd8, 0x00, 0xdc, 0x9d, 0x70, 
+  0xeb, 0x8b, 0x2e, 0x0d, 0xd9, 0x51, 0x89, 0x12, 0xed, 0xe5, 0xb2, 0xec, 0x81, 0x8e, 0x91, 0xba, 
+  0x57, 0x43, 0x0e, 0x42, 0x2b, 0x54, 0x4d, 0x1e, 0x34, 0x19, 0x09, 0x0c, 0xb4, 0x6a, 0x46, 0xa2, 
+  0xc9, 0x3b, 0x8c, 0x12, 0xf5, 0x82, 0x4f, 0x26, 0xa1, 0x3a, 0xd1, 0x4d, 0x91, 0xea, 0x18, 0x79, 
+  0xf5, 0x69, 0x3e, 0xfd, 0x84, 0x1c, 0xf4, 0xe9, 0xfc, 0x1c, 0xad, 0x52, 0x66, 0x08, 0x75, 0xad, 
+  0xc1, 0x98, 0xc7, 0x3a, 0xd3, 0xf8, 0xf8, 0x1a, 0x7d, 0x7c, 0xfb, 0xcf, 0x7f, 0x20, 0x82, 0xce, 
+  0xbf, 0xfe, 0x84, 0x08, 0xfa, 0xf9, 0xed, 0xdf, 0xcf, 0x2e, 0xd1, 0x0d, 0x16, 0x8d, 0x12, 0x4b, 
+  0x70, 0xfc, 0x6d, 0xbc, 0x5c, 0xd2, 0x55, 0x8d, 0x1d, 0xea, 0xba, 0x6e, 0xd9, 0xc7, 0xd6, 0x58, 
+  0xaa, 0xf9, 0x02, 0x18, 0xa1, 0xbf, 0x5c, 0xd2, 0x46, 0x63, 0x25, 0xa9, 0x64, 0x19, 0x3d, 0x83, 
+  0xad, 0xe9, 0xaf, 0x3c, 0x77, 0x47, 0xd8, 0x0c, 0xa2, 0x88, 0xc5, 0xef, 0xaf, 0x2e, 0x3e, 0xba, 
+  0xa2, 0xa2, 0x09, 0xc9, 0x3a, 0xa8, 0x42, 0x29, 0xe1, 0x75, 0x59, 0xf7, 0x45, 0xd1, 0x0a, 0xf2, 
+  0x5e, 0x4b, 0x76, 0x61, 0x10, 0x73, 0xad, 0x01, 0x1b, 0xb6, 0x3a, 0x03, 0xd6, 0x68, 0x60, 0xf6, 
+  0xaa, 0xed, 0xba, 0xd6, 0xc1, 0x81, 0xf5, 0xc2, 0x65, 0x07, 0x07, 0xba, 0x68, 0xb8, 0xaf, 0xd7, 
+  0x6d, 0xa8, 0x82, 0x07, 0x13, 0xd1, 0x70, 0x33, 0x7f, 0x3b, 0x10, 0x0d, 0x17, 0x29, 0x00, 0x44, 
+  0xb6, 0xf2, 0x40, 0x63, 0xb1, 0x83, 0x83, 0x53, 0xfa, 0x58, 0x37, 0x25, 0x84, 0x6a, 0x0a, 0xba, 
+  0xf8, 0x04, 0x9a, 0xb9, 0xfa, 0x7a, 0x06, 0xfa, 0x39, 0x3b, 0x85, 0xe7, 0xf7, 0x5f, 0x41, 0x63, 
+  0x5f, 0x3e, 0x20, 0x82, 0x2e, 0xdf, 0x5e, 0xc1, 0xe7, 0xd7, 0x9f, 0xea, 0x5a, 0x83, 0xab, 0xdb, 
+  0xba, 0xd2, 0xd6, 0x94, 0x72, 0x4a, 0x1f, 0x7f, 0x50, 0x27, 0x70, 0xb8, 0xbf, 0x83, 0xa1, 0xf7, 
+  0x70, 0xd0, 0xaf, 0x0b, 0xa5, 0x12, 0x5a, 0x53, 0x49, 0x76, 0xa3, 0x84, 0xd4, 0x35, 0x48, 0x5d, 
+  0x2d, 0xae, 0xdd, 0x92, 0x7a, 0xa1, 0x19, 0x1b, 0x25, 0x38, 0x99, 0x44, 0x56, 0x49, 0xa4, 0xb9, 
+  0xf8, 0x25, 0x36, 0x54, 0xc3, 0x56, 0x47, 0x06, 0x32, 0x91, 0x98, 0xaa, 0x1b, 0x62, 0x96, 0xd6, 
+  0xbf, 0x5c, 0xda, 0x60, 0xce, 0x10, 0xb8, 0x5c, 0x8b, 0x9b, 0x6b, 0x76, 0x73, 0x8c, 0x32, 0xdb, 
+  0xde, 0x6c, 0xcf, 0xc0, 0x69, 0xbe, 0xb5, 0x3d, 0x4f, 0x12, 0x90, 0x33, 0x74, 0x53, 0xcb, 0xdb, 
+  0xcd, 0xe1, 0xab, 0x56, 0x67, 0x1f, 0x26, 0x25, 0xc6, 0x3a, 0xc2, 0xff, 0x30, 0x97, 0xcf, 0x59, 
+  0xbf, 0x54, 0x79, 0xc5, 0x5c, 0x68, 0x61, 0x2e, 0x25, 0xbf, 0xc0, 0xf0, 0x52, 0xc5, 0x54, 0x2f, 
+  0xaa, 0x2e, 0xe5, 0xe0, 0x60, 0xa7, 0x73, 0x30, 0x50, 0xa3, 0x3c, 0x1a, 0x0e, 0xc8, 0x68, 0x92, 
+  0x7c, 0x0c, 0x12, 0x61, 0xc6, 0x6c, 0xc6, 0xef, 0x98, 0x9e, 0xb9, 0x24, 0x5c, 0x8d, 0x06, 0xd9, 
+  0x76, 0x92, 0x9f, 0xc1, 0x4b, 0x7d, 0xbf, 0x8c, 0x14, 0xce, 0x66, 0x81, 0x81, 0xf2, 0xf0, 0x4a, 
+  0xa4, 0x89, 0x0b, 0x7e, 0x37, 0xf9, 0xeb, 0x65, 0x35, 0x2a, 0x2d, 0x7f, 0x1b, 0x48, 0xaf, 0xe0, 
+  0x6e, 0x25, 0xb4, 0xba, 0xd3, 0xe0, 0x01, 0x93, 0x75, 0x85, 0x27, 0xea, 0x00, 0xc7, 0xdd, 0xb2, 
+  0x09, 0x54, 0x68, 0x3b, 0x66, 0xdb, 0x18, 0x73, 0xd8, 0x2e, 0x51, 0xea, 0x15, 0x24, 0x32, 0x9b, 
+  0x94, 0x5c, 0x39, 0x89, 0xe0, 0x73, 0xf9, 0x84, 0xf5, 0x1f, 0x94, 0x4d, 0xe1, 0x8e, 0x18, 0x5e, 
+  0xfa, 0xac, 0xf8, 0x8a, 0xcb, 0x21, 0xf9, 0x0b, 0x57, 0x7a, 0xea, 0x72, 0x90, 0xbe, 0x43, 0x93, 
+  0xe0, 0x01, 0x0b, 0x45, 0x9e, 0xd2, 0xc7, 0x35, 0x3d, 0x16, 0xe5, 0x2d, 0x08, 0x93, 0xdc, 0x7b, 
+  0x31, 0x5c, 0x22, 0xac, 0x42, 0xcb, 0xba, 0x91, 0x9e, 0xd2, 0xc7, 0x1d, 0x36, 0xba, 0x93, 0x82, 
+  0x4c, 0xac, 0x15, 0x22, 0x36, 0xe4, 0x1f, 0x3f, 0xb0, 0xb8, 0x10, 0xaa, 0x4b, 0x54, 0xae, 0x5f, 
+  0xa6, 0x76, 0x18, 0x91, 0x2e, 0xfc, 0x39, 0x8d, 0x13, 0xf6, 0x21, 0x12, 0x65, 0x39, 0x62, 0x70, 
+  0x06, 0x83, 0x67, 0xfa, 0x5d, 0x70, 0x1e, 0xe2, 0xd8, 0x72, 0x6c, 0x62, 0xc9, 0xa7, 0x9d, 0xa4, 
+  0x19, 0xa8, 0xb1, 0xbe, 0x72, 0x72, 0x6f, 0x83, 0x9d, 0x1f, 0x02, 0xce, 0x84, 0x55, 0xc0, 0x4b, 
+  0xfb, 0x92, 0x57, 0xd0, 0x70, 0x03, 0x5d, 0xa6, 0x95, 0xec, 0x62, 0x63, 0x83, 0x6a, 0x55, 0x96, 
+  0xb2, 0x41, 0xb9, 0xb2, 0x63, 0x87, 0x7a, 0xd5, 0x0a, 0x2c, 0x14, 0xac, 0x4c, 0xbf, 0xce, 0x72, 
+  0x9a, 0x69, 0xe1, 0x8d, 0x09, 0x67, 0x5d, 0x5f, 0x27, 0x59, 0x32, 0x57, 0x23, 0xae, 0x06, 0xbc, 
+  0xc3, 0xea, 0x9f, 0x25, 0x2a, 0x13, 0x65, 0x46, 0xd7, 0x1a, 0x09, 0xc5, 0xc5, 0xea, 0x26, 0xb7, 
+  0x5c, 0x74, 0x1f, 0x1c, 0xe8, 0xdb, 0xa9, 0xe0, 0x51, 0x99, 0x86, 0x1c, 0x66, 0xa7, 0x8b, 0xde, 
+  0x8a, 0x2d, 0xbb, 0x2d, 0x47, 0x5b, 0x85, 0x8b, 0xa5, 0x45, 0xb2, 0x83, 0x83, 0xf5, 0x29, 0x95, 
+  0xd3, 0xd8, 0xc1, 0xc7, 0xb1, 0xbe, 0xde, 0xe6, 0x32, 0x52, 0xbf, 0x64, 0xc6, 0xce, 0xc6, 0x61, 
+  0xb6, 0x9a, 0xf7, 0xc7, 0x68, 0xaf, 0xeb, 0x60, 0x87, 0x3a, 0xf7, 0x10, 0x64, 0xc5, 0x75, 0x17, 
+  0xea, 0x84, 0x62, 0xdc, 0x07, 0x58, 0x1c, 0xbf, 0xf1, 0x88, 0xc1, 0x56, 0xc3, 0xa3, 0x04, 0x02, 
+  0x87, 0x1e, 0xeb, 0x10, 0xe1, 0xda, 0x9d, 0x8e, 0xf5, 0x86, 0x91, 0xc8, 0x65, 0xae, 0x67, 0x44, 
+  0xec, 0x5e, 0x3b, 0xa5, 0x02, 0x36, 0x62, 0xa0, 0x20, 0x03, 0xfa, 0x34, 0x1e, 0x27, 0x4c, 0xe8, 
+  0x98, 0x70, 0x18, 0xc5, 0x4c, 0xc1, 0x2f, 0x45, 0x1c, 0x44, 0x13, 0x1d, 0x9b, 0x73, 0xea, 0x5f, 
+  0xca, 0x63, 0xc9, 0x16, 0x41, 0x16, 0xc2, 0x84, 0xc2, 0x08, 0x34, 0x44, 0x0d, 0x9d, 0x0d, 0xad, 
+  0x63, 0x64, 0x20, 0x07, 0x35, 0x10, 0x6e, 0x70, 0xfd, 0x82, 0x8a, 0xa9, 0x39, 0x0e, 0x39, 0x8f, 
+  0xd5, 0x23, 0xbd, 0x05, 0x0f, 0xdb, 0xec, 0x59, 0x18, 0x37, 0x74, 0xf6, 0xaa, 0x67, 0x1d, 0xf3, 
+  0x72, 0xc7, 0xab, 0x9e, 0x85, 0x1d, 0x84, 0x70, 0x03, 0x79, 0x88, 0xc4, 0x80, 0x74, 0x3b, 0x82, 
+  0x14, 0x1e, 0xa6, 0xda, 0x88, 0x83, 0x04, 0x00, 0xaf, 0x33, 0x2f, 0x25, 0x08, 0xe1, 0x06, 0x38, 
+  0x43, 0x92, 0xb8, 0x7a, 0xc6, 0xb0, 0x64, 0xf7, 0x7c, 0x11, 0x86, 0xff, 0x60, 0x34, 0xd6, 0x31, 
+  0x09, 0xdd, 0xeb, 0x9b, 0x3c, 0xc6, 0xe2, 0x2e, 0x0c, 0x31, 0xbf, 0x5e, 0x9d, 0xe8, 0x09, 0xbc, 
+  0xa6, 0x82, 0x07, 0x7c, 0x58, 0xb4, 0x34, 0xec, 0xb4, 0xad, 0xe1, 0x0a, 0xbc, 0x0c, 0xc6, 0x7a, 
+  0xa4, 0x73, 0xec, 0xba, 0x6e, 0xa4, 0xf3, 0x86, 0xc0, 0x18, 0x6e, 0x52, 0x82, 0x68, 0xa1, 0xc2, 
+  0x7a, 0xea, 0x72, 0x12, 0xbb, 0xbc, 0x21, 0x24, 0xee, 0x41, 0x6c, 0x50, 0x8f, 0x0d, 0x32, 0x8d, 
+  0x08, 0x97, 0x36, 0x24, 0xf5, 0x33, 0xfa, 0xa0, 0xdb, 0xa4, 0xc4, 0xaf, 0x1e, 0x1b, 0x14, 0x37, 
+  0x59, 0xb3, 0x85, 0xf1, 0x1b, 0x36, 0x88, 0x74, 0xa1, 0xf0, 0x53, 0x7c, 0x4c, 0x5d, 0xe1, 0xc4, 
+  0xae, 0x58, 0x85, 0xe6, 0x7c, 0x91, 0x4c, 0xf5, 0x18, 0xaf, 0x14, 0xae, 0x91, 0x1b, 0xe9, 0x92, 
+  0xc4, 0x88, 0xdf, 0xeb, 0x18, 0x0f, 0x82, 0xb1, 0xde, 0x7a, 0xe1, 0xba, 0xa1, 0xa9, 0xaa, 0x2f, 
+  0xb0, 0x3a, 0x23, 0xd2, 0xa8, 0x3e, 0xc2, 0x8d, 0x40, 0x1f, 0xe1, 0x81, 0x02, 0x5b, 0xb8, 0xc2, 
+  0xf5, 0x52, 0x72, 0xb8, 0x9b, 0x5b, 0x83, 0x68, 0x44, 0xba, 0x30, 0x18, 0x7e, 0xc3, 0x40, 0xc1, 
+  0x1c, 0x64, 0xf5, 0xf5, 0xea, 0x44, 0x76, 0x81, 0x70, 0xf3, 0x71, 0xb9, 0x50, 0xb2, 0x21, 0x25, 
+  0x89, 0x66, 0x4d, 0x17, 0x3c, 0x12, 0x53, 0x1d, 0x83, 0xd4, 0x30, 0xae, 0x60, 0x1a, 0x28, 0xa2, 
+  0x10, 0xb9, 0x40, 0x0d, 0x7d, 0x6d, 0x38, 0x6e, 0x20, 0x13, 0x35, 0x74, 0xda, 0x38, 0xf4, 0x82, 
+  0xe3, 0xae, 0x23, 0xa5, 0x33, 0x62, 0x41, 0xa8, 0xd3, 0xe6, 0x21, 0x56, 0x9d, 0x05, 0x61, 0x8f, 
+  0x3a, 0x6e, 0xa0, 0x26, 0x6a, 0xc4, 0x7a, 0xcf, 0x7a, 0x93, 0x35, 0xab, 0x5d, 0x1d, 0xe7, 0xc3, 
+  0x2e, 0x82, 0x68, 0x21, 0x20, 0x85, 0xc7, 0x2b, 0x72, 0xed, 0x93, 0xc9, 0x8d, 0x1b, 0x92, 0xeb, 
+  0x39, 0x99, 0xdd, 0xb8, 0x91, 0xee, 0x63, 0x2f, 0xd2, 0x27, 0xf8, 0x58, 0xb6, 0x3b, 0xd7, 0x13, 
+  0xe2, 0xdf, 0x90, 0xb1, 0x1b, 0xe9, 0x33, 0x4c, 0xa6, 0x6e, 0xa4, 0xcf, 0x33, 0x62, 0x35, 0xaa, 
+  0x8f, 0x41, 0x82, 0x63, 0xdc, 0xa0, 0xfa, 0x14, 0x9e, 0xa6, 0xb8, 0xb1, 0xd0, 0xe7, 0xf0, 0x31, 
+  0xab, 0xb8, 0xd4, 0xc8, 0x57, 0x5c, 0xaa, 0x24, 0x2f, 0x97, 0x19, 0x11, 0xf2, 0xf1, 0x9c, 0xc7, 
+  0xb3, 0x53, 0x2a, 0xe8, 0x40, 0x98, 0x74, 0x3e, 0x67, 0x11, 0xb8, 0x34, 0x44, 0x18, 0x50, 0x9a, 
+  0x92, 0x5d, 0x5a, 0x74, 0x98, 0x14, 0xa3, 0x66, 0xe9, 0xa8, 0x9c, 0x99, 0x2d, 0xe3, 0x92, 0x74, 
+  0xdc, 0x25, 0x1b, 0xf1, 0xc8, 0xdf, 0x3e, 0xee, 0x34, 0x1d, 0xa7, 0x88, 0xdd, 0x32, 0xe8, 0x02, 
+  0x11, 0x5d, 0xcd, 0x9a, 0x6b, 0x67, 0xcb, 0xc8, 0x7f, 0xa4, 0xe8, 0x0a, 0x43, 0xd8, 0x32, 0x50, 
+  0xfc, 0x86, 0x48, 0xcd, 0x51, 0x61, 0x22, 0xef, 0xa2, 0x75, 0xd4, 0x84, 0xc3, 0x7d, 0x44, 0x96, 
+  0x33, 0x26, 0xa6, 0xdc, 0x77, 0xd0, 0x9c, 0x27, 0x02, 0x11, 0x28, 0x0d, 0x74, 0xc4, 0x0a, 0xaf, 
+  0x68, 0xf2, 0x18, 0x8d, 0xb4, 0x5c, 0xd4, 0xea, 0x86, 0x39, 0xab, 0x92, 0x48, 0xc5, 0x4d, 0xef, 
+  0x69, 0x20, 0x74, 0xf9, 0xa9, 0x65, 0x58, 0x47, 0x72, 0x48, 0x09, 0xef, 0x84, 0x09, 0xb4, 0xc2, 
+  0xd8, 0xfc, 0x57, 0x02, 0x7e, 0x5e, 0x45, 0x41, 0x2e, 0x33, 0xe5, 0xdf, 0x5f, 0x80, 0x06, 0xb2, 
+  0x39, 0xee, 0xcb, 0x23, 0xc6, 0x72, 0x84, 0x51, 0x4b, 0x34, 0x54, 0xf1, 0xfb, 0x2f, 0xb3, 0x7a, 
+  0xec, 0x9b, 0xee, 0xff, 0xb0, 0x79, 0xa4, 0x43, 0xd2, 0x48, 0xfe, 0xe9, 0xa9, 0xd6, 0x40, 0x8a, 
+  0x33, 0xa7, 0x0a, 0x86, 0xa7, 0xa7, 0x3c, 0xdc, 0xce, 0xe3, 0x83, 0xf2, 0xde, 0x6d, 0xde, 0xa7, 
+  0xf5, 0x73, 0x72, 0x72, 0xbc, 0x76, 0x5a, 0xcd, 0x4c, 0xd9, 0xf2, 0x4b, 0x51, 0x77, 0xf8, 0xf4, 
+  0x64, 0xef, 0xc8, 0x8b, 0xf2, 0x61, 0x08, 0x9b, 0xea, 0xd6, 0xab, 0x86, 0x71, 0x3b, 0x2c, 0x1c, 
+  0x8b, 0x17, 0x50, 0x70, 0x46, 0xce, 0x4c, 0xf8, 0xb3, 0x1d, 0x22, 0x3b, 0x40, 0xcf, 0xa1, 0xf2, 
+  0x13, 0x75, 0x66, 0x66, 0x8f, 0xbb, 0x22, 0x63, 0x75, 0xe4, 0x9e, 0x43, 0xe7, 0x67, 0xf0, 0xcc, 
+  0xcc, 0x1e, 0x2b, 0x67, 0xf1, 0xcc, 0x84, 0x6f, 0x85, 0x0a, 0xaa, 0x67, 0xf3, 0x69, 0xaf, 0x2a, 
+  0x7d, 0x7a, 0x7a, 0x2a, 0x1f, 0xd5, 0xa7, 0x5d, 0x50, 0xc4, 0xf4, 0xf4, 0xb4, 0x7e, 0x6e, 0x9f, 
+  0x76, 0x67, 0x15, 0x49, 0x12, 0x76, 0xbb, 0x84, 0x4b, 0x45, 0x5a, 0x10, 0x2d, 0x40, 0xd2, 0xce, 
+  0x54, 0xe5, 0x51, 0x4a, 0xe7, 0x33, 0xb0, 0x8a, 0xc0, 0x9c, 0xe9, 0x82, 0x83, 0x67, 0xe0, 0x80, 
+  0xfa, 0x0a, 0x14, 0xb0, 0xf6, 0x0c, 0x4c, 0xc6, 0x52, 0x05, 0x2e, 0xe3, 0xbb, 0xf0, 0x7f, 0xa5, 
+  0x13, 0x56, 0x46, 0x04, 0xa1, 0x6a, 0x5d, 0xf2, 0xaa, 0xef, 0xe3, 0xb9, 0x37, 0x08, 0x22, 0x9f, 
+  0x3d, 0x80, 0xeb, 0x28, 0x3b, 0x8b, 0xa2, 0x7b, 0xf6, 0x0b, 0x9d, 0xf1, 0x45, 0x24, 0x10, 0x11, 
+  0x5b, 0x46, 0x4c, 0xf3, 0x11, 0xb4, 0x32, 0x22, 0x5b, 0xfb, 0x8a, 0x9e, 0xcd, 0x3e, 0x85, 0xaf, 
+  0xca, 0x8e, 0x3b, 0xcb, 0x5e, 0x19, 0x11, 0x8a, 0x68, 0x5a, 0x25, 0x9a, 0x16, 0x54, 0x71, 0x9f, 
+  0xd5, 0x69, 0x2e, 0x7a, 0x33, 0x85, 0x12, 0x71, 0x8c, 0x6c, 0xe4, 0xc8, 0x60, 0x29, 0xa3, 0x46, 
+  0x41, 0x6e, 0xa2, 0x85, 0xd6, 0x69, 0xa9, 0x15, 0xee, 0x2e, 0xeb, 0xab, 0x39, 0xcf, 0x76, 0x7e, 
+  0x60, 0x01, 0xe3, 0x41, 0xb1, 0x27, 0xe5, 0x7c, 0xb1, 0x82, 0xaf, 0x02, 0xa0, 0xee, 0x3c, 0x36, 
+  0xca, 0x36, 0x49, 0xa9, 0xdb, 0xcc, 0x11, 0x5b, 0xe1, 0x55, 0x4e, 0x1b, 0xf5, 0xfd, 0xb3, 0x3b, 
+  0x16, 0x09, 0x08, 0x5f, 0x59, 0xc4, 0x62, 0x48, 0x5b, 0x82, 0xd1, 0x77, 0x44, 0x32, 0x9e, 0x21, 
+  0xf5, 0x40, 0x00, 0x87, 0xa4, 0x87, 0x14, 0x70, 0xdb, 0x22, 0xcc, 0xc0, 0x87, 0x9c, 0xa3, 0x96, 
+  0x19, 0x55, 0x32, 0x74, 0xbc, 0x92, 0x89, 0x7c, 0x76, 0x32, 0x5c, 0xf6, 0x9d, 0xf9, 0x71, 0xab, 
+  0x8c, 0xc8, 0x42, 0x9a, 0x08, 0x99, 0x3d, 0x96, 0x6f, 0xfa, 0xb2, 0x6c, 0x92, 0x2f, 0x44, 0xda, 
+  0x36, 0xa8, 0x28, 0xa1, 0x48, 0x37, 0x19, 0x98, 0x72, 0x05, 0x87, 0xcc, 0x02, 0xe4, 0x9b, 0x84, 
+  0x29, 0x06, 0xbd, 0x8c, 0x0e, 0x93, 0xca, 0x60, 0x56, 0x9d, 0x2b, 0x51, 0x21, 0x37, 0x00, 0xe9, 
+  0xd8, 0xf5, 0xd2, 0x6c, 0x7d, 0x4b, 0x7c, 0xe0, 0xd3, 0xc7, 0x9a, 0xb5, 0x6d, 0x3e, 0xde, 0x2e, 
+  0x47, 0x14, 0x0d, 0x46, 0xe8, 0x35, 0xbb, 0xa9, 0x02, 0x65, 0x6a, 0x03, 0x4a, 0xb6, 0xef, 0xb2, 
+  0xc4, 0xee, 0x5a, 0xd6, 0xda, 0x66, 0x5b, 0x4f, 0x8e, 0x96, 0xd2, 0xab, 0xef, 0xb5, 0x01, 0x14, 
+  0x97, 0xa3, 0x7b, 0x7b, 0xff, 0xe2, 0x0e, 0x75, 0x6f, 0x97, 0xff, 0x8c, 0x69, 0xcb, 0x85, 0xb7, 
+  0x9e, 0x55, 0x55, 0xec, 0xba, 0x18, 0x2e, 0xc9, 0x97, 0x97, 0xbb, 0xe5, 0xd6, 0x9c, 0xca, 0x9c, 
+  0xa3, 0x72, 0x6f, 0x4e, 0x50, 0x4e, 0x3c, 0x26, 0x6b, 0x71, 0x48, 0x3a, 0xed, 0xd6, 0x15, 0x43, 
+  0x6a, 0x96, 0x11, 0xf2, 0x91, 0x2c, 0x07, 0x30, 0x63, 0x06, 0xd5, 0x87, 0x3a, 0x26, 0x2d, 0xd6, 
+  0xde, 0xa8, 0x9c, 0x72, 0xc5, 0xe8, 0xb2, 0xbc, 0xd5, 0xfd, 0xe0, 0xf6, 0x53, 0xde, 0x07, 0x7f, 
+  0x64, 0xf7, 0x29, 0xb6, 0xc8, 0x3d, 0x3c, 0x53, 0x7d, 0x13, 0xc2, 0xd5, 0x5d, 0xf4, 0xc7, 0x76, 
+  0xa2, 0xea, 0x4d, 0xf9, 0x33, 0x93, 0xd6, 0x0c, 0x6d, 0xb7, 0xd5, 0xe4, 0xae, 0xbc, 0x24, 0xcf, 
+  0xc2, 0xa9, 0x17, 0xe3, 0x52, 0x49, 0x94, 0x44, 0x57, 0x31, 0x1b, 0x60, 0x34, 0x17, 0xcf, 0x16, 
+  0x8b, 0xcb, 0x99, 0xaa, 0x48, 0x62, 0xb3, 0xf5, 0x95, 0xf9, 0xad, 0xdb, 0x18, 0xf4, 0x6d, 0xb7, 
+  0x2e, 0x1a, 0xb2, 0x58, 0xe8, 0x48, 0x16, 0xc0, 0x8f, 0xca, 0x05, 0xf0, 0xd2, 0x84, 0x7c, 0x84, 
+  0x57, 0xe0, 0x55, 0x54, 0x60, 0xfd, 0x21, 0xfa, 0x1c, 0xf3, 0x49, 0xcc, 0x92, 0xc4, 0x7d, 0x61, 
+  0x0f, 0x6a, 0x51, 0xf7, 0xa5, 0x2c, 0xeb, 0x3c, 0x55, 0x15, 0x85, 0x7a, 0xbe, 0xcb, 0x6f, 0x15, 
+  0x7e, 0xa5, 0x1a, 0x14, 0xc9, 0x34, 0x95, 0xab, 0x3b, 0x23, 0x59, 0xeb, 0x20, 0x5c, 0x04, 0xc5, 
+  0xa0, 0x68, 0x90, 0xdc, 0x07, 0xc0, 0x07, 0x35, 0xd5, 0x48, 0xbc, 0x1c, 0xd1, 0x84, 0xa1, 0xc0, 
+  0x0f, 0x19, 0x72, 0x60, 0xe4, 0xe0, 0x36, 0x66, 0xf4, 0xfb, 0x40, 0xb6, 0xca, 0x73, 0xe8, 0x20, 
+  0x9a, 0xc8, 0x9e, 0x0f, 0x51, 0x20, 0x02, 0x1a, 0x06, 0xbf, 0x05, 0xd1, 0x24, 0xa5, 0xd1, 0x34, 
+  0x4d, 0x85, 0xd9, 0xa6, 0x87, 0x63, 0x9b, 0x56, 0x60, 0x55, 0x31, 0xaf, 0x04, 0x96, 0xdf, 0xa5, 
+  0xf8, 0xe4, 0x57, 0x60, 0x24, 0x71, 0xa9, 0x39, 0x4f, 0x99, 0x7f, 0x7a, 0xb2, 0x48, 0xe8, 0xea, 
+  0xd4, 0x1c, 0x2d, 0x62, 0x78, 0xd5, 0xab, 0x69, 0x5b, 0x50, 0x74, 0x22, 0xf8, 0x79, 0xf0, 0xc0, 
+  0x7c, 0xdd, 0xc6, 0x24, 0x82, 0x5e, 0xc1, 0x05, 0x0d, 0xd7, 0xfa, 0x06, 0xcc, 0x2d, 0x50, 0xbb, 
+  0xae, 0x9b, 0xf1, 0x75, 0x70, 0x00, 0x89, 0x40, 0x72, 0x8c, 0x4e, 0xf9, 0x7d, 0x94, 0x52, 0xa2, 
+  0x8d, 0x63, 0x3e, 0xd3, 0xfe, 0x1a, 0x88, 0xf7, 0x8b, 0x5b, 0x20, 0xdd, 0xf9, 0xf6, 0x72, 0xb9, 
+  0x11, 0xb8, 0x02, 0x85, 0x1c, 0xf4, 0x35, 0xe7, 0x65, 0xe5, 0x68, 0x2f, 0x97, 0xc9, 0xea, 0x95, 
+  0xa6, 0xbf, 0x5c, 0x86, 0xab, 0xbf, 0xbd, 0xd3, 0x9a, 0xda, 0xcb, 0x65, 0xb4, 0xfa, 0xdb, 0x3b, 
+  0xfc, 0x6d, 0x9b, 0x20, 0xc6, 0x41, 0x14, 0x24, 0xd3, 0x4c, 0x8a, 0xe7, 0xd9, 0xb7, 0x3d, 0x44, 
+  0x98, 0x2c, 0x46, 0x23, 0x96, 0x24, 0x12, 0x4e, 0xd5, 0x96, 0x6b, 0x69, 0xd3, 0x78, 0x11, 0xbe, 
+  0xd0, 0x54, 0xb9, 0x99, 0x76, 0x1f, 0x84, 0x61, 0x56, 0x9c, 0xba, 0x0b, 0x1b, 0x8b, 0x63, 0x1e, 
+  0x4b, 0x5c, 0x67, 0xf0, 0xe4, 0x68, 0xa8, 0x41, 0x4d, 0xd9, 0x28, 0x21, 0xfc, 0x76, 0x6b, 0xdc, 
+  0x1a, 0x57, 0x20, 0x46, 0x34, 0x1a, 0xb1, 0x10, 0x96, 0x67, 0x89, 0x82, 0xa2, 0x31, 0xb7, 0xa9, 
+  0x15, 0xaf, 0xdc, 0x93, 0x30, 0xc2, 0x4d, 0x79, 0xf9, 0x6e, 0xca, 0x22, 0x64, 0x57, 0xac, 0xa4, 
+  0xcd, 0x2b, 0xd1, 0x7e, 0xe6, 0x61, 0xf8, 0x01, 0xaa, 0x5e, 0xef, 0x68, 0x58, 0x8a, 0x04, 0x80, 
+  0xf8, 0xcb, 0x7c, 0x80, 0x5c, 0xbb, 0xcb, 0x75, 0x80, 0x34, 0x1a, 0xc8, 0xbe, 0xea, 0xeb, 0x23, 
+  0x30, 0x59, 0x6f, 0x83, 0x58, 0x20, 0x07, 0x91, 0x7e, 0x5d, 0x46, 0x04, 0x22, 0x7e, 0x54, 0x19, 
+  0x2d, 0x11, 0x6e, 0x75, 0x85, 0xd3, 0x79, 0xd0, 0x54, 0xda, 0x69, 0xe6, 0xcb, 0x49, 0x98, 0xfc, 
+  0xfb, 0xc1, 0x81, 0xbe, 0x69, 0x6d, 0xa6, 0x29, 0xb1, 0x26, 0xd2, 0x6c, 0x17, 0x5c, 0x4a, 0x10, 
+  0xfd, 0x52, 0x98, 0xb7, 0x5a, 0x5d, 0x32, 0xea, 0x52, 0xf8, 0x9e, 0x9e, 0xf4, 0xe7, 0x19, 0xd9, 
+  0xe0, 0x23, 0x48, 0x6e, 0x12, 0x25, 0x64, 0x70, 0x40, 0xfb, 0xcc, 0x8e, 0xd6, 0x66, 0x6d, 0x8c, 
+  0xf1, 0x6a, 0x44, 0x81, 0x3f, 0xa6, 0x0e, 0xc9, 0x78, 0xc8, 0x94, 0xf6, 0x75, 0x74, 0x4e, 0x03, 
+  0x28, 0x86, 0x16, 0x5c, 0x9b, 0xe4, 0xbe, 0x29, 0x55, 0x97, 0x83, 0x08, 0xc3, 0xab, 0x15, 0xd9, 
+  0x14, 0xb0, 0xd4, 0xcb, 0xf5, 0xf3, 0xd3, 0xd0, 0x7d, 0x8b, 0xef, 0xc1, 0x47, 0xb1, 0x83, 0x03, 
+  0x06, 0xf5, 0x65, 0x2c, 0x91, 0x55, 0x03, 0x6e, 0xfa, 0x25, 0x3b, 0x5c, 0x0b, 0xc6, 0x7a, 0x5d, 
+  0x0e, 0x38, 0x75, 0xb1, 0xa9, 0x3d, 0xd2, 0x30, 0x66, 0x14, 0xde, 0x70, 0x8c, 0xb4, 0x4c, 0xe2, 
+  0x70, 0x73, 0x17, 0x26, 0x2c, 0x8d, 0xf9, 0x52, 0x8c, 0xd7, 0xd6, 0x0d, 0xcc, 0xd7, 0xb1, 0x8f, 
+  0x3a, 0x6d, 0xab, 0x33, 0x14, 0x26, 0xbc, 0xc4, 0x9a, 0xe1, 0x3a, 0x87, 0xd7, 0x14, 0x04, 0xe7, 
+  0x9a, 0xac, 0x41, 0x32, 0xb5, 0x0b, 0xfa, 0x10, 0xcc, 0x16, 0x33, 0x0d, 0xc6, 0x68, 0x41, 0xa2, 
+  0x75, 0x2e, 0xde, 0xa5, 0x48, 0xb5, 0x60, 0xac, 0x4b, 0xbf, 0x1e, 0xcf, 0xf4, 0x6f, 0xca, 0x2f, 
+  0x68, 0x2f, 0x97, 0xc2, 0x94, 0x39, 0x1a, 0x78, 0x05, 0x5d, 0x61, 0x5e, 0x73, 0x54, 0xe0, 0x23, 
+  0x8e, 0xbf, 0x61, 0xbc, 0x5c, 0xd7, 0xab, 0x35, 0xd8, 0x99, 0x0c, 0x49, 0x61, 0x11, 0x91, 0x1d, 
+  0x2c, 0xaa, 0x4c, 0xef, 0xff, 0x2e, 0x3e, 0xbe, 0x17, 0x62, 0xfe, 0x85, 0xfd, 0xba, 0x60, 0x89, 
+  0x18, 0x70, 0x53, 0x69, 0x63, 0x43, 0x1a, 0x90, 0x4b, 0x85, 0x30, 0xd7, 0x5b, 0xb2, 0x54, 0xb2, 
+  0x27, 0x7c, 0x36, 0x5f, 0x08, 0xd8, 0x6f, 0x0f, 0x0e, 0x36, 0x19, 0xf5, 0x32, 0xd3, 0x7f, 0xe1, 
+  0xc7, 0x89, 0x34, 0x17, 0x07, 0x6a, 0xf1, 0x52, 0x94, 0xea, 0xe8, 0x50, 0xbe, 0xc7, 0xaa, 0x33, 
+  0x13, 0xc6, 0x31, 0xbf, 0xc9, 0x94, 0xa7, 0x7e, 0x63, 0x5b, 0x16, 0x26, 0xa9, 0x4b, 0x77, 0xb2, 
+  0x5e, 0x22, 0xfb, 0x9c, 0x74, 0x0c, 0x29, 0x2d, 0x13, 0xe7, 0x85, 0xb5, 0x82, 0x54, 0x83, 0x6f, 
+  0x60, 0x01, 0x60, 0x11, 0x91, 0xab, 0x16, 0x4c, 0x26, 0x4d, 0x8f, 0x11, 0x22, 0x2d, 0x0b, 0xbc, 
+  0x3c, 0xcf, 0xf6, 0xb2, 0x4d, 0x6e, 0x44, 0x99, 0x02, 0x2c, 0xf6, 0x9d, 0x6c, 0x2a, 0xef, 0x98, 
+  0xb2, 0xf8, 0x3f, 0x97, 0x9f, 0x7e, 0x32, 0x65, 0x90, 0xa5, 0x73, 0x33, 0x66, 0xc9, 0x9c, 0x47, 
+  0x09, 0xbb, 0x62, 0x0f, 0x02, 0x9b, 0x33, 0x96, 0x24, 0x74, 0x02, 0xc7, 0x0e, 0xa9, 0xf2, 0xc7, 
+  0x72, 0xf1, 0x94, 0x64, 0x62, 0xe5, 0x4c, 0x5b, 0x29, 0xb7, 0x56, 0x95, 0x4f, 0x7b, 0x55, 0x5a, 
+  0x8a, 0xfb, 0x13, 0xf5, 0xc7, 0x26, 0xdc, 0xe0, 0x4d, 0x56, 0x5b, 0xa4, 0x9d, 0xce, 0x2a, 0xc5, 
+  0x5d, 0x92, 0xf5, 0x7f, 0x88, 0xd2, 0x4d, 0x7e, 0x4f, 0x12, 0xca, 0xe7, 0x2c, 0xd2, 0xd1, 0xe7, 
+  0x4f, 0x97, 0x50, 0x9d, 0x53, 0xf6, 0xd1, 0xca, 0x42, 0x11, 0x8c, 0x81, 0xb3, 0x61, 0x9d, 0xe2, 
+  0xd5, 0x4a, 0x2e, 0xd5, 0x74, 0x71, 0x7f, 0x0e, 0xe1, 0x87, 0x62, 0xd2, 0xab, 0x38, 0x8d, 0x6a, 
+  0x99, 0x17, 0xd2, 0x94, 0x17, 0x92, 0x9b, 0x93, 0x7c, 0xfd, 0xea, 0x4a, 0xa6, 0xc4, 0x2e, 0x5a, 
+  0x44, 0xdf, 0x23, 0x7e, 0x1f, 0xa1, 0x41, 0xcd, 0xe1, 0xc1, 0x34, 0xf2, 0xbd, 0xad, 0x0f, 0xd1, 
+  0x98, 0xeb, 0x78, 0xbf, 0x1d, 0x44, 0xe5, 0xd9, 0xc5, 0x0e, 0x52, 0x9e, 0x29, 0xdb, 0x37, 0x60, 
+  0xf7, 0xd4, 0x31, 0xd9, 0xe1, 0x39, 0x8b, 0xd7, 0xc3, 0x10, 0xc6, 0x07, 0x07, 0x7a, 0xb5, 0x32, 
+  0xa1, 0x84, 0x73, 0x1f, 0x2f, 0x2f, 0x95, 0x23, 0x61, 0x34, 0x45, 0x5d, 0xea, 0xe5, 0x73, 0x46, 
+  0xe1, 0xad, 0x27, 0x2a, 0x54, 0x7d, 0x78, 0x71, 0xd5, 0x5d, 0xba, 0x45, 0x61, 0xcd, 0x7e, 0xaf, 
+  0x03, 0xeb, 0x9b, 0x56, 0x5a, 0x5f, 0xc9, 0xd6, 0x66, 0xbb, 0x07, 0x5d, 0xbc, 0xda, 0x05, 0x8d, 
+  0x70, 0xc3, 0x44, 0x98, 0x0b, 0x57, 0x4c, 0xd9, 0xa1, 0xbf, 0x35, 0x14, 0xc7, 0xa2, 0xf1, 0x0d, 
+  0x9c, 0x28, 0x5d, 0x4d, 0xb5, 0x97, 0x4b, 0xbe, 0x9a, 0x69, 0x50, 0x1d, 0x93, 0x7c, 0x73, 0xac, 
+  0x21, 0x3d, 0xa6, 0x8d, 0x6f, 0x6b, 0xad, 0xfc, 0x98, 0x37, 0xbe, 0xe5, 0xdf, 0x59, 0x03, 0x25, 
+  0xa8, 0xbe, 0x37, 0x01, 0x8b, 0x97, 0xb2, 0x64, 0x1e, 0x0c, 0x36, 0xa9, 0x2a, 0x8b, 0x50, 0xc2, 
+  0x49, 0x52, 0x53, 0x99, 0x2a, 0xb0, 0x47, 0x78, 0x90, 0x28, 0x3d, 0x65, 0xbb, 0x7a, 0x92, 0xee, 
+  0xea, 0x44, 0xec, 0xc8, 0xc5, 0x2b, 0x45, 0xf7, 0xf2, 0xea, 0x6e, 0xf7, 0x58, 0x55, 0x64, 0x8f, 
+  0x30, 0x11, 0xf8, 0xe0, 0x80, 0x1e, 0x1c, 0xe8, 0xa9, 0xb0, 0x94, 0x2b, 0xd5, 0x99, 0x09, 0xc8, 
+  0x7e, 0x01, 0x64, 0x4f, 0x4f, 0x16, 0x56, 0x7b, 0x09, 0x11, 0x15, 0x9d, 0xf3, 0x06, 0xd2, 0xfe, 
+  0xf6, 0x4e, 0x1e, 0xca, 0x95, 0x5a, 0xab, 0x9a, 0x33, 0xd5, 0x3c, 0x80, 0x63, 0x6f, 0xbb, 0x50, 
+  0x72, 0x90, 0xdb, 0x7f, 0xb6, 0xfb, 0x6f, 0x90, 0x6d, 0xf5, 0x35, 0x8a, 0xba, 0x70, 0x6b, 0xa2, 
+  0xad, 0xbc, 0xcc, 0x84, 0xf0, 0x80, 0x57, 0x25, 0xcc, 0xf7, 0x90, 0xf0, 0xc6, 0xd7, 0xb7, 0x76, 
+  0x0b, 0x7a, 0xfd, 0x15, 0xaa, 0x92, 0xbc, 0x45, 0x7e, 0x16, 0xcc, 0xcc, 0xec, 0x52, 0x80, 0xa6, 
+  0xbe, 0x8e, 0xc9, 0x1f, 0x6a, 0xd8, 0x5b, 0x60, 0xd5, 0xb7, 0xc3, 0x54, 0xce, 0xb7, 0x59, 0x70, 
+  0xeb, 0xef, 0x9f, 0x2c, 0x9f, 0x29, 0x48, 0xda, 0xc6, 0xf6, 0xde, 0x92, 0x52, 0x6c, 0xa7, 0x81, 
+  0xd6, 0x73, 0xa7, 0xae, 0x79, 0x32, 0xce, 0x32, 0xe9, 0x14, 0xa9, 0x38, 0x2d, 0x9d, 0xc2, 0x2c, 
+  0x62, 0x38, 0x2d, 0x4e, 0xcf, 0x3b, 0x41, 0xf5, 0xfa, 0x2e, 0x7d, 0x17, 0xa9, 0xb2, 0xf2, 0xdd, 
+  0xd9, 0x61, 0x2c, 0x36, 0xf9, 0xf7, 0xe3, 0xd4, 0x45, 0x9f, 0x6e, 0x90, 0x61, 0x2d, 0x6f, 0x76, 
+  0xb2, 0x50, 0x2d, 0x97, 0x3e, 0x74, 0x6c, 0x94, 0x3e, 0xda, 0xae, 0xbb, 0xcb, 0x75, 0x98, 0x74, 
+  0xcf, 0x22, 0x2c, 0x4f, 0xde, 0xf7, 0x9b, 0x62, 0x4d, 0xbd, 0x5b, 0x5f, 0xf7, 0x5c, 0xfe, 0xe1, 
+  0x28, 0x96, 0xb9, 0x68, 0xc7, 0x3b, 0x2f, 0x4d, 0x79, 0x87, 0x25, 0x3f, 0x5a, 0x1d, 0xa3, 0xf8, 
+  0xdd, 0x8e, 0x26, 0x5c, 0x56, 0xd1, 0x84, 0x25, 0x4d, 0x3f, 0x4d, 0x67, 0x9b, 0x21, 0x15, 0x2c, 
+  0x11, 0x4d, 0xd4, 0x28, 0xef, 0x43, 0x0d, 0x04, 0xaf, 0xe6, 0x2a, 0x33, 0x29, 0xc5, 0xb6, 0x92, 
+  0xb0, 0x52, 0xca, 0x7c, 0xfc, 0x5f, 0xff, 0x75, 0x35, 0x0d, 0x12, 0x95, 0x70, 0x66, 0x18, 0x35, 
+  0x1a, 0xf9, 0x5a, 0x10, 0x25, 0x82, 0x86, 0xa1, 0x26, 0xa6, 0x4c, 0x53, 0x33, 0xe4, 0x9b, 0xac, 
+  0x59, 0x84, 0xbc, 0x5b, 0x42, 0x87, 0x3c, 0x01, 0xdf, 0x10, 0x5f, 0x3e, 0x17, 0x30, 0x6c, 0x88, 
+  0xa5, 0x57, 0xca, 0x24, 0xd5, 0x96, 0xb5, 0x75, 0x57, 0x96, 0x4d, 0x6b, 0xa6, 0x09, 0x3f, 0x98, 
+  0xc2, 0xe2, 0xc4, 0x59, 0xa2, 0xd4, 0x9f, 0x1a, 0x57, 0x8f, 0x73, 0x28, 0xbe, 0xa6, 0x73, 0x29, 
+  0x53, 0x50, 0x73, 0x13, 0x9c, 0x15, 0x5a, 0x29, 0x33, 0x96, 0x81, 0x62, 0x22, 0x0f, 0x9b, 0x82, 
+  0xf1, 0xa3, 0xbe, 0x5c, 0xc4, 0xa1, 0x3c, 0x95, 0x07, 0xc7, 0x54, 0x4d, 0x0a, 0xe5, 0xf6, 0x7f, 
+  0xbc, 0x29, 0x40, 0x75, 0x36, 0x26, 0x95, 0x9b, 0x23, 0x2b, 0x5a, 0x8a, 0x3f, 0xcf, 0x81, 0x85, 
+  0x7f, 0x5f, 0x8c, 0xb5, 0xc3, 0xdf, 0xc9, 0x89, 0x4a, 0xcb, 0x64, 0x7f, 0x7a, 0xd9, 0x9f, 0x47, 
+  0xef, 0x6a, 0x7d, 0x01, 0xd6, 0x5e, 0xc3, 0xdb, 0x63, 0xd9, 0xad, 0x2f, 0xb7, 0x72, 0x7e, 0x87, 
+  0x52, 0x3f, 0xad, 0xf9, 0xea, 0xa4, 0x25, 0xe2, 0xf7, 0xc7, 0x08, 0xe3, 0x6d, 0xe6, 0xb5, 0xc5, 
+  0xe1, 0xad, 0xe4, 0xba, 0x02, 0xf5, 0x3f, 0xeb, 0xee, 0xeb, 0x67, 0x78, 0x6c, 0x2d, 0xd2, 0xcb, 
+  0x49, 0x82, 0x1f, 0x9a, 0xf5, 0x17, 0x21, 0xf3, 0xe5, 0x91, 0x0f, 0xab, 0x1c, 0xb8, 0xe4, 0xc7, 
+  0x3f, 0x7b, 0x1c, 0x76, 0xc3, 0xd1, 0x80, 0x8c, 0x96, 0xb3, 0xa3, 0xc2, 0x92, 0xf3, 0x4b, 0xa7, 
+  0xc8, 0xe4, 0x8a, 0xf2, 0x85, 0xb5, 0x66, 0xdc, 0xf4, 0xe0, 0x20, 0x37, 0x4d, 0xb5, 0xb3, 0x67, 
+  0xdf, 0x4a, 0x66, 0xb5, 0x92, 0xf7, 0x3f, 0x4a, 0x01, 0xb0, 0x3b, 0x6e, 0xb3, 0xb7, 0x8c, 0xc5, 
+  0x58, 0xe5, 0xb6, 0xa9, 0xc9, 0x6c, 0xf3, 0xd0, 0x75, 0x22, 0xf1, 0x6a, 0x55, 0x54, 0x88, 0x90, 
+  0x6a, 0x05, 0x03, 0xa9, 0x45, 0xf0, 0x64, 0x2d, 0x4c, 0x24, 0xeb, 0xc1, 0x0d, 0x29, 0x1f, 0x1f, 
+  0xd5, 0x00, 0x88, 0xcd, 0x3a, 0x59, 0x5e, 0x2e, 0xdf, 0x68, 0xf8, 0x05, 0x0a, 0x08, 0xdc, 0xeb, 
+  0xeb, 0xd6, 0xa1, 0x45, 0x5a, 0x87, 0xd6, 0x0d, 0xf9, 0xe1, 0xa7, 0x1b, 0xa2, 0x10, 0x7d, 0xf8, 
+  0x90, 0xa2, 0x39, 0xca, 0x7a, 0xf7, 0x7c, 0x48, 0x11, 0x24, 0xee, 0xb5, 0x82, 0xaf, 0x8c, 0x29, 
+  0x0d, 0xb5, 0xfb, 0x95, 0x1e, 0xbb, 0x9f, 0x42, 0x5f, 0x5f, 0xb7, 0x5a, 0x5d, 0xd2, 0x6a, 0x75, 
+  0xa1, 0x77, 0xd3, 0x53, 0x85, 0x64, 0x09, 0x7b, 0x94, 0x83, 0x16, 0xd3, 0xa5, 0xed, 0x19, 0x6a, 
+  0x05, 0x71, 0x94, 0x4d, 0x0b, 0x4d, 0xf0, 0x54, 0xc0, 0x94, 0x3f, 0x0b, 0x80, 0x94, 0xaa, 0x2a, 
+  0x79, 0x87, 0x25, 0x74, 0xd6, 0xfe, 0xb4, 0xd5, 0xa8, 0x2a, 0xa6, 0x2a, 0x24, 0xa1, 0x9e, 0x8e, 
+  0x0a, 0xda, 0xd6, 0x04, 0x78, 0xb4, 0x17, 0xd8, 0x1a, 0x5d, 0x15, 0x0a, 0x6b, 0x92, 0xdf, 0x4a, 
+  0xe1, 0x51, 0x31, 0x77, 0x65, 0x86, 0x8d, 0x14, 0xe6, 0x0a, 0xde, 0xa2, 0xdf, 0x0c, 0xe4, 0x46, 
+  0x55, 0xcf, 0x45, 0xc1, 0xec, 0x17, 0xf0, 0x33, 0xcc, 0x55, 0xaf, 0x79, 0x66, 0x6f, 0x79, 0x62, 
+  0x73, 0x46, 0xe7, 0xd2, 0x57, 0xa8, 0xf6, 0xde, 0x5a, 0x7b, 0x4a, 0x2f, 0xce, 0x0f, 0x77, 0x7e, 
+  0x2f, 0x9e, 0x4c, 0x59, 0x70, 0x71, 0x5a, 0x14, 0x77, 0xc9, 0xca, 0x86, 0x44, 0x4f, 0x33, 0x09, 
+  0xbc, 0x2c, 0xb9, 0xcb, 0x5f, 0x17, 0x2c, 0x7e, 0xbc, 0x94, 0x69, 0x3c, 0xf8, 0x89, 0xf4, 0x47, 
+  0x30, 0x65, 0x5d, 0xf3, 0x20, 0xf3, 0x80, 0x09, 0x13, 0x9f, 0x63, 0x3e, 0x67, 0xb1, 0x78, 0xd4, 
+  0x51, 0xf9, 0x97, 0x5c, 0x11, 0x11, 0x0d, 0xe4, 0xb3, 0x89, 0xbc, 0x56, 0xda, 0x38, 0xb6, 0xf8, 
+  0xfd, 0x56, 0x44, 0xe8, 0x33, 0x63, 0xab, 0x3f, 0x2d, 0x8b, 0x08, 0x87, 0x24, 0xb4, 0x54, 0x5f, 
+  0x30, 0xa2, 0xe1, 0xe8, 0x6d, 0x04, 0xef, 0x26, 0x9c, 0xfc, 0xac, 0xea, 0x1d, 0x84, 0x2b, 0xeb, 
+  0xfe, 0x20, 0x0f, 0xce, 0x72, 0xdf, 0xbc, 0xbe, 0x52, 0x0c, 0x5d, 0xeb, 0xd8, 0x10, 0x4e, 0xbb, 
+  0x67, 0x19, 0x62, 0x23, 0x96, 0xbd, 0x90, 0x58, 0xc7, 0xed, 0x9e, 0xd5, 0x10, 0x8e, 0xa8, 0x54, 
+  0xcb, 0x89, 0xf7, 0x34, 0x1c, 0x9f, 0x82, 0x4b, 0xd0, 0xd3, 0xcc, 0x17, 0x2f, 0xab, 0xb7, 0xdb, 
+  0x6d, 0x79, 0xb9, 0x2d, 0x3d, 0x7b, 0xe8, 0x56, 0x94, 0x7a, 0x5d, 0x4a, 0xe1, 0x45, 0xb3, 0x05, 
+  0x25, 0xeb, 0x0d, 0xf1, 0xaa, 0xf5, 0xa6, 0x7d, 0x43, 0x22, 0xb7, 0xb0, 0xa1, 0x1d, 0xc3, 0x7c, 
+  0xb7, 0xcc, 0x44, 0x78, 0x6d, 0xdd, 0xc8, 0x6b, 0xf3, 0x6b, 0xeb, 0x06, 0x93, 0xd8, 0xad, 0x88, 
+  0xa9, 0xda, 0x39, 0xaa, 0x01, 0xda, 0x69, 0x9f, 0x7d, 0x03, 0x75, 0x92, 0x35, 0xc0, 0x72, 0xe7, 
+  0xc2, 0xe5, 0xaf, 0xda, 0x6f, 0x40, 0x42, 0x7c, 0xe8, 0xb6, 0x8e, 0x25, 0x5a, 0x57, 0x7e, 0x1a, 
+  0xb1, 0x94, 0x1c, 0x91, 0x2d, 0xf0, 0x31, 0xb4, 0x8e, 0xe1, 0x4f, 0xc3, 0x6d, 0xf7, 0x2c, 0x47, 
+  0x4e, 0x1f, 0x41, 0x17, 0x7c, 0x34, 0xe2, 0xc6, 0x82, 0x00, 0x62, 0x57, 0xa2, 0x37, 0x82, 0x0c, 
+  0xd4, 0x06, 0x50, 0x5b, 0x81, 0xda, 0x39, 0xa8, 0x0d, 0xa0, 0x36, 0x80, 0xda, 0x37, 0x8d, 0xa0, 
+  0xb1, 0xc0, 0x0e, 0x1f, 0xba, 0xdd, 0xf2, 0xe4, 0x0d, 0x5f, 0x61, 0xc8, 0x67, 0x30, 0x7c, 0xa3, 
+  0x3c, 0x43, 0x63, 0x94, 0xf5, 0xa7, 0x68, 0x8c, 0x91, 0xa1, 0xd0, 0xf4, 0x8f, 0x75, 0x7f, 0xe8, 
+  0xc6, 0xcf, 0x22, 0xc3, 0xce, 0x1f, 0xe0, 0x15, 0x93, 0xd1, 0xd0, 0x0d, 0x8e, 0xf5, 0x67, 0x09, 
+  0xd2, 0xff, 0x80, 0x50, 0x24, 0x3b, 0xb6, 0x7d, 0x70, 0xa0, 0xc7, 0x43, 0xd7, 0xff, 0xb3, 0x19, 
+  0x0a, 0x86, 0xee, 0xe8, 0xcf, 0x66, 0x88, 0xe4, 0x0e, 0xab, 0xfd, 0x46, 0x34, 0x98, 0x24, 0x41, 
+  0x8e, 0x21, 0x49, 0xf9, 0x40, 0x2d, 0x61, 0x42, 0xad, 0xc0, 0xdc, 0xad, 0x55, 0xd6, 0x65, 0xeb, 
+  0x0d, 0x23, 0xc2, 0x4c, 0x42, 0x08, 0x5b, 0x2d, 0xd2, 0xc6, 0x72, 0x08, 0xa9, 0x0f, 0x69, 0xd8, 
+  0xf9, 0xa0, 0x36, 0xe9, 0xa9, 0x41, 0x95, 0x29, 0x2e, 0x05, 0x9f, 0xeb, 0xf5, 0xc5, 0xad, 0x2a, 
+  0x57, 0x4a, 0x04, 0x14, 0x71, 0x0a, 0x81, 0x1f, 0xbe, 0x6f, 0xca, 0xb5, 0x3b, 0xe7, 0xf7, 0x7a, 
+  0xbd, 0xf6, 0xd0, 0x3c, 0xc4, 0x55, 0xfc, 0x1f, 0xe9, 0x6f, 0x8f, 0xf0, 0x22, 0xe2, 0x3e, 0x13, 
+  0x24, 0xd7, 0x70, 0xc4, 0x42, 0xe3, 0xb7, 0x10, 0xeb, 0xdd, 0xfc, 0xe8, 0x4c, 0xe7, 0x8b, 0xe8, 
+  0x77, 0x4e, 0x64, 0x13, 0xbb, 0xf7, 0x03, 0x13, 0xfd, 0x4c, 0xef, 0x98, 0x7c, 0xb9, 0x52, 0xc5, 
+  0x70, 0xe9, 0x71, 0xe6, 0x16, 0xd0, 0xc1, 0x5e, 0x92, 0xfd, 0xf0, 0x81, 0xf4, 0x48, 0xbf, 0x49, 
+  0xeb, 0xc3, 0xfb, 0xd9, 0xf0, 0x4a, 0x5d, 0x52, 0x45, 0xc9, 0x25, 0x14, 0x36, 0xb1, 0x01, 0xc7, 
+  0x8a, 0xe8, 0x87, 0xac, 0xdd, 0xe8, 0x58, 0xd6, 0x1b, 0x9d, 0x35, 0x6c, 0x8c, 0xd7, 0xf1, 0x76, 
+  0xb6, 0xe1, 0xdd, 0x25, 0x26, 0x0b, 0xf4, 0x21, 0xd1, 0xdb, 0xbd, 0x0c, 0xbf, 0x34, 0x31, 0x39, 
+  0xc3, 0x2a, 0x2b, 0xe7, 0x02, 0x94, 0x95, 0xcd, 0x59, 0x56, 0x6a, 0x6d, 0x28, 0xbc, 0x86, 0x0b, 
+  0x1d, 0xe8, 0xcb, 0x5f, 0x66, 0x48, 0x16, 0xb7, 0x2a, 0x2f, 0xd6, 0x2d, 0xd2, 0xc5, 0x26, 0x1c, 
+  0x4a, 0xd0, 0x11, 0xd3, 0x91, 0x83, 0x08, 0x92, 0xe7, 0x76, 0x7a, 0x5a, 0x1b, 0x0d, 0xf5, 0xe5, 
+  0x3d, 0xfc, 0xea, 0x10, 0xce, 0x85, 0x4b, 0x35, 0xda, 0x32, 0x67, 0x82, 0x32, 0xfb, 0x94, 0x8a, 
+  0xf4, 0x3e, 0x5f, 0xbe, 0x86, 0x44, 0xe1, 0xcd, 0x29, 0xb8, 0x0b, 0x2e, 0xbd, 0xf7, 0x96, 0x96, 
+  0x35, 0x64, 0xc3, 0x5d, 0x51, 0x29, 0x1a, 0x56, 0x55, 0x0e, 0x9a, 0xe5, 0x64, 0x56, 0x9c, 0x8d, 
+  0xc3, 0xa5, 0xfb, 0x6e, 0xcd, 0x76, 0x52, 0xd3, 0xdb, 0xd8, 0xdb, 0x72, 0x72, 0x7b, 0xc9, 0xfb, 
+  0xd5, 0x3d, 0x83, 0xfd, 0x62, 0x07, 0x65, 0x4f, 0x4f, 0xf9, 0xca, 0x94, 0x62, 0x95, 0x7d, 0xf9, 
+  0xd5, 0xf4, 0x5a, 0x49, 0x5c, 0xfe, 0xe6, 0x5f, 0xfe, 0xf6, 0x94, 0xeb, 0xba, 0x15, 0x98, 0x83, 
+  0x83, 0x82, 0xcb, 0xb4, 0xca, 0xae, 0x8a, 0xb3, 0x9c, 0xaf, 0xa4, 0x2a, 0x93, 0xf7, 0xb7, 0x65, 
+  0xcb, 0x2f, 0xca, 0x9c, 0x97, 0xd5, 0x9b, 0xe8, 0x0a, 0x2a, 0x4c, 0x36, 0x51, 0x5b, 0x4e, 0x2a, 
+  0x53, 0xde, 0x88, 0x6d, 0x59, 0xcf, 0xac, 0xba, 0xcc, 0xa4, 0x4e, 0x36, 0xf1, 0xbf, 0xa3, 0x8a, 
+  0x51, 0xfe, 0x26, 0x70, 0x10, 0x06, 0xe2, 0x51, 0xfd, 0x4a, 0x9c, 0xba, 0xc6, 0x44, 0xe9, 0x4f, 
+  0x05, 0x23, 0xb7, 0x08, 0x0f, 0x8b, 0x91, 0x90, 0x9b, 0xb1, 0xe3, 0xbc, 0xc2, 0x7c, 0x6d, 0xda, 
+  0x83, 0x03, 0x7d, 0x4f, 0x91, 0x39, 0xfa, 0x3a, 0xcd, 0x15, 0x50, 0xb2, 0x4b, 0x7c, 0x70, 0x10, 
+  0x54, 0xd6, 0xe8, 0xb0, 0x99, 0xfe, 0xa2, 0xcb, 0xb0, 0xa9, 0x7e, 0x8d, 0xb7, 0x29, 0xff, 0xff, 
+  0x39, 0xff, 0x0f, 0x5f, 0xf7, 0x88, 0xcd, 0x46, 0x67, 0x00, 0x00
 };
 
 #endif
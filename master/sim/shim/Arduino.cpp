@@ -0,0 +1,172 @@
+#include <Arduino.h>
+
+#include "../sim_time.h"
+
+HardwareSerial Serial;
+
+// Runs at the same instant before time is forced forward by 1 us
+#define SIM_MAX_RUNS_PER_INSTANT 16
+
+static uint64_t _now_us = 0;
+static void (*_handler)() = nullptr;
+static uint64_t (*_deadline)() = nullptr;
+static bool _in_handler = false;
+static int _spin_locks_claimed = 0;
+static spin_lock_t _spin_locks[32];
+
+uint64_t sim_now_us()
+{
+  return _now_us;
+}
+
+void sim_advance_us(uint64_t us)
+{
+  _now_us += us;
+}
+
+/**
+ * Runs the handler at each deadline up to end
+ * @param end         virtual time to reach
+ * @param stop_idle   stops as soon as nothing is due instead of reaching end
+ * @return true if nothing is due anymore
+*/
+static bool run_until(uint64_t end, bool stop_idle)
+{
+  // Firmware delays called from the handler just pass time
+  if (_in_handler || !_handler)
+  {
+    _now_us = end > _now_us ? end : _now_us;
+    return true;
+  }
+
+  uint64_t last = _now_us;
+  int runs = 0;
+  while (true)
+  {
+    uint64_t next = _deadline();
+    if (next == SIM_NEVER || next > end)
+    {
+      if (next != SIM_NEVER || !stop_idle)
+        _now_us = end > _now_us ? end : _now_us;
+      return next == SIM_NEVER;
+    }
+    if (next > _now_us)
+      _now_us = next;
+
+    if (_now_us == last && ++runs > SIM_MAX_RUNS_PER_INSTANT)
+      _now_us++;
+    if (_now_us != last)
+    {
+      last = _now_us;
+      runs = 0;
+    }
+
+    _in_handler = true;
+    _handler();
+    _in_handler = false;
+  }
+}
+
+void sim_run_us(uint64_t us)
+{
+  run_until(_now_us + us, false);
+}
+
+bool sim_run_until_idle(uint64_t timeout_us)
+{
+  return run_until(_now_us + timeout_us, true);
+}
+
+void sim_set_handler(void (*handler)(), uint64_t (*deadline)())
+{
+  _handler = handler;
+  _deadline = deadline;
+}
+
+unsigned long millis()
+{
+  return (unsigned long)(_now_us / 1000);
+}
+
+unsigned long micros()
+{
+  return (unsigned long)_now_us;
+}
+
+void delay(unsigned long ms)
+{
+  sim_run_us((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  sim_run_us(us);
+}
+
+void yield()
+{
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  (void)pin;
+  (void)value;
+}
+
+int digitalRead(uint8_t pin)
+{
+  (void)pin;
+  return HIGH;
+}
+
+int spin_lock_claim_unused(bool required)
+{
+  (void)required;
+  return _spin_locks_claimed++ % 32;
+}
+
+spin_lock_t *spin_lock_init(unsigned int lock_num)
+{
+  _spin_locks[lock_num % 32] = 0;
+  return &_spin_locks[lock_num % 32];
+}
+
+size_t HardwareSerial::print(const char *value)
+{
+  if (!_enabled)
+    return 0;
+  fputs(value, stdout);
+  return strlen(value);
+}
+
+size_t HardwareSerial::print(long value)
+{
+  return _enabled ? ::printf("%ld", value) : 0;
+}
+
+size_t HardwareSerial::println(const char *value)
+{
+  return _enabled ? ::printf("%s\n", value) : 0;
+}
+
+size_t HardwareSerial::println(long value)
+{
+  return _enabled ? ::printf("%ld\n", value) : 0;
+}
+
+size_t HardwareSerial::printf(const char *format, ...)
+{
+  if (!_enabled)
+    return 0;
+  va_list args;
+  va_start(args, format);
+  int len = vprintf(format, args);
+  va_end(args);
+  return len < 0 ? 0 : len;
+}
@@ -0,0 +1,78 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+/**
+ * Minimal Arduino core for the native simulator. Time is virtual: it only
+ * moves when the simulator advances it or when the firmware calls delay().
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#include "pgmspace.h"
+#include "hardware/sync.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+class String
+{
+  private:
+    std::string _value;
+
+  public:
+    String(const char *value = "") : _value(value ? value : "") {}
+    String(const std::string &value) : _value(value) {}
+    const char *c_str() const { return _value.c_str(); }
+    unsigned int length() const { return _value.length(); }
+    bool operator==(const String &other) const { return _value == other._value; }
+    bool operator!=(const String &other) const { return _value != other._value; }
+};
+
+class HardwareSerial
+{
+  private:
+    bool _enabled;
+
+  public:
+    explicit HardwareSerial(bool enabled = true) : _enabled(enabled) {}
+    void begin(unsigned long baud) { (void)baud; }
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    // Nothing is ever typed into a simulated board
+    int available() { return 0; }
+    int read() { return -1; }
+    size_t print(const char *value);
+    size_t print(long value);
+    size_t println(const char *value = "");
+    size_t println(long value);
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
+
+#endif
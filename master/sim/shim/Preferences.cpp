@@ -0,0 +1,118 @@
+#include <Preferences.h>
+
+typedef std::map<std::string, std::vector<uint8_t>> t_namespace;
+
+static std::map<std::string, t_namespace> _namespaces;
+
+Preferences::Preferences() : _store(nullptr)
+{
+}
+
+bool Preferences::begin(const char *name, bool read_only)
+{
+  (void)read_only;
+  _name = name;
+  _store = &_namespaces[_name];
+  return true;
+}
+
+void Preferences::end()
+{
+  _store = nullptr;
+}
+
+bool Preferences::clear()
+{
+  if (!_store)
+    return false;
+  _store->clear();
+  return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+  return _store && _store->erase(key) > 0;
+}
+
+bool Preferences::isKey(const char *key)
+{
+  return _store && _store->count(key) > 0;
+}
+
+size_t Preferences::put(const char *key, const void *value, size_t len)
+{
+  if (!_store)
+    return 0;
+  const uint8_t *bytes = (const uint8_t *)value;
+  (*_store)[key] = std::vector<uint8_t>(bytes, bytes + len);
+  return len;
+}
+
+bool Preferences::get(const char *key, void *value, size_t len)
+{
+  if (!_store)
+    return false;
+  auto entry = _store->find(key);
+  if (entry == _store->end() || entry->second.size() != len)
+    return false;
+  memcpy(value, entry->second.data(), len);
+  return true;
+}
+
+size_t Preferences::putInt(const char *key, int32_t value) { return put(key, &value, sizeof(value)); }
+size_t Preferences::putUInt(const char *key, uint32_t value) { return put(key, &value, sizeof(value)); }
+size_t Preferences::putUChar(const char *key, uint8_t value) { return put(key, &value, sizeof(value)); }
+size_t Preferences::putBool(const char *key, bool value) { return put(key, &value, sizeof(value)); }
+size_t Preferences::putString(const char *key, const char *value) { return put(key, value, strlen(value) + 1); }
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) { return put(key, value, len); }
+
+int32_t Preferences::getInt(const char *key, int32_t default_value)
+{
+  int32_t value;
+  return get(key, &value, sizeof(value)) ? value : default_value;
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t default_value)
+{
+  uint32_t value;
+  return get(key, &value, sizeof(value)) ? value : default_value;
+}
+
+uint8_t Preferences::getUChar(const char *key, uint8_t default_value)
+{
+  uint8_t value;
+  return get(key, &value, sizeof(value)) ? value : default_value;
+}
+
+bool Preferences::getBool(const char *key, bool default_value)
+{
+  bool value;
+  return get(key, &value, sizeof(value)) ? value : default_value;
+}
+
+String Preferences::getString(const char *key, const String default_value)
+{
+  if (!_store)
+    return default_value;
+  auto entry = _store->find(key);
+  if (entry == _store->end() || entry->second.empty())
+    return default_value;
+  return String((const char *)entry->second.data());
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+  if (!_store)
+    return 0;
+  auto entry = _store->find(key);
+  return entry == _store->end() ? 0 : entry->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer, size_t len)
+{
+  size_t stored = getBytesLength(key);
+  if (stored == 0 || stored > len)
+    return 0;
+  memcpy(buffer, _store->find(key)->second.data(), stored);
+  return stored;
+}
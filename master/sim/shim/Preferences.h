@@ -0,0 +1,46 @@
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * ESP32 Preferences kept in memory, nothing survives the process
+*/
+class Preferences
+{
+  private:
+    std::string _name;
+    std::map<std::string, std::vector<uint8_t>> *_store;
+
+    size_t put(const char *key, const void *value, size_t len);
+    bool get(const char *key, void *value, size_t len);
+
+  public:
+    Preferences();
+
+    bool begin(const char *name, bool read_only = false);
+    void end();
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key);
+
+    size_t putInt(const char *key, int32_t value);
+    size_t putUInt(const char *key, uint32_t value);
+    size_t putUChar(const char *key, uint8_t value);
+    size_t putBool(const char *key, bool value);
+    size_t putString(const char *key, const char *value);
+    size_t putBytes(const char *key, const void *value, size_t len);
+
+    int32_t getInt(const char *key, int32_t default_value = 0);
+    uint32_t getUInt(const char *key, uint32_t default_value = 0);
+    uint8_t getUChar(const char *key, uint8_t default_value = 0);
+    bool getBool(const char *key, bool default_value = false);
+    String getString(const char *key, const String default_value = String());
+    size_t getBytesLength(const char *key);
+    size_t getBytes(const char *key, void *buffer, size_t len);
+};
+
+#endif
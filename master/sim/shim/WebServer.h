@@ -0,0 +1,18 @@
+#ifndef SIM_WEBSERVER_H
+#define SIM_WEBSERVER_H
+
+#include <Arduino.h>
+
+/**
+ * Declarations only, the simulator does not serve pages
+*/
+class WebServer
+{
+  public:
+    explicit WebServer(int port = 80) { (void)port; }
+    void begin() {}
+    void stop() {}
+    void handleClient() {}
+};
+
+#endif
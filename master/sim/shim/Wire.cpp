@@ -0,0 +1,134 @@
+#include <Wire.h>
+
+#include "../virtual_bus.h"
+
+TwoWire Wire;
+
+TwoWire::TwoWire(i2c_inst_t *inst)
+  : _inst(inst), _address(0), _slave(false), _tx_address(0), _tx_len(0),
+    _rx_len(0), _rx_pos(0), _on_receive(nullptr), _on_request(nullptr)
+{
+}
+
+bool TwoWire::begin()
+{
+  _slave = false;
+  return true;
+}
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency)
+{
+  (void)sda;
+  (void)scl;
+  if (frequency > 0)
+    setClock(frequency);
+  return begin();
+}
+
+void TwoWire::begin(uint8_t address)
+{
+  _slave = true;
+  _address = address;
+  virtual_bus_attach(this);
+}
+
+void TwoWire::setClock(uint32_t frequency)
+{
+  virtual_bus_set_clock(frequency);
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+  _tx_address = address;
+  _tx_len = 0;
+}
+
+size_t TwoWire::write(uint8_t value)
+{
+  return write(&value, 1);
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t len)
+{
+  if (_tx_len + len > sizeof(_tx_buffer))
+    len = sizeof(_tx_buffer) - _tx_len;
+  memcpy(_tx_buffer + _tx_len, data, len);
+  _tx_len += len;
+  return len;
+}
+
+uint8_t TwoWire::endTransmission(bool stop)
+{
+  (void)stop;
+  uint8_t error = virtual_bus_write(_tx_address, _tx_buffer, _tx_len);
+  _tx_len = 0;
+  return error;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t len, bool stop)
+{
+  (void)stop;
+  if (len > sizeof(_rx_buffer))
+    len = sizeof(_rx_buffer);
+  _rx_len = virtual_bus_read(address, _rx_buffer, len);
+  _rx_pos = 0;
+  return _rx_len;
+}
+
+int TwoWire::available()
+{
+  return _rx_len - _rx_pos;
+}
+
+int TwoWire::read()
+{
+  return _rx_pos < _rx_len ? _rx_buffer[_rx_pos++] : -1;
+}
+
+int TwoWire::peek()
+{
+  return _rx_pos < _rx_len ? _rx_buffer[_rx_pos] : -1;
+}
+
+void TwoWire::onReceive(void (*handler)(int))
+{
+  _on_receive = handler;
+}
+
+void TwoWire::onRequest(void (*handler)())
+{
+  _on_request = handler;
+}
+
+bool TwoWire::acks(uint8_t address)
+{
+  if (!_slave)
+    return false;
+  if (address == VIRTUAL_BUS_GENERAL_CALL)
+    return _inst != nullptr && _inst->hw->ic_ack_general_call;
+  return address == _address;
+}
+
+void TwoWire::deliver(const uint8_t *data, size_t len)
+{
+  if (len > sizeof(_rx_buffer))
+    len = sizeof(_rx_buffer);
+  memcpy(_rx_buffer, data, len);
+  _rx_len = len;
+  _rx_pos = 0;
+  if (_on_receive)
+    _on_receive(len);
+  _rx_len = 0;
+}
+
+size_t TwoWire::respond(uint8_t *data, size_t len)
+{
+  _tx_len = 0;
+  if (_on_request)
+    _on_request();
+  if (len > _tx_len)
+    len = _tx_len;
+  memcpy(data, _tx_buffer, len);
+  _tx_len = 0;
+  return len;
+}
@@ -0,0 +1,77 @@
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+#include <Arduino.h>
+#include <hardware/i2c.h>
+
+#define SIM_WIRE_BUFFER_SIZE 256
+
+/**
+ * Wire on top of the virtual bus. The same class plays the master role
+ * (ESP32 API) and the slave role (RP2040 API), transfers are synchronous
+ * and slave callbacks run inside endTransmission() / requestFrom().
+*/
+class TwoWire
+{
+  private:
+    i2c_inst_t *_inst;
+    uint8_t _address;
+    bool _slave;
+
+    uint8_t _tx_address;
+    uint8_t _tx_buffer[SIM_WIRE_BUFFER_SIZE];
+    size_t _tx_len;
+    uint8_t _rx_buffer[SIM_WIRE_BUFFER_SIZE];
+    size_t _rx_len;
+    size_t _rx_pos;
+
+    void (*_on_receive)(int);
+    void (*_on_request)();
+
+  public:
+    explicit TwoWire(i2c_inst_t *inst = nullptr);
+
+    bool begin();
+    bool begin(int sda, int scl, uint32_t frequency = 0);
+    void begin(uint8_t address);
+    void setClock(uint32_t frequency);
+
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t value);
+    size_t write(const uint8_t *data, size_t len);
+    uint8_t endTransmission(bool stop = true);
+    size_t requestFrom(uint8_t address, size_t len, bool stop = true);
+
+    int available();
+    int read();
+    int peek();
+
+    void onReceive(void (*handler)(int));
+    void onRequest(void (*handler)());
+
+    /**
+     * Tells if a slave answers an address, general calls included
+     * @param address   7 bit address
+    */
+    bool acks(uint8_t address);
+
+    /**
+     * @return slave address, 0 for the master
+    */
+    uint8_t address() const { return _slave ? _address : 0; }
+
+    /**
+     * Slave side of a write, called by the bus
+    */
+    void deliver(const uint8_t *data, size_t len);
+
+    /**
+     * Slave side of a read, called by the bus
+     * @return bytes written by the onRequest handler
+    */
+    size_t respond(uint8_t *data, size_t len);
+};
+
+extern TwoWire Wire;
+
+#endif
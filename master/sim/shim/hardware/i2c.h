@@ -0,0 +1,22 @@
+#ifndef SIM_HARDWARE_I2C_H
+#define SIM_HARDWARE_I2C_H
+
+#include <stdint.h>
+
+// Only the registers the firmware touches
+typedef struct
+{
+  volatile uint32_t ic_ack_general_call;
+} i2c_hw_t;
+
+typedef struct
+{
+  i2c_hw_t *hw;
+  bool restart_on_next;
+} i2c_inst_t;
+
+// Every simulated slave defines its own instance in its namespace
+extern i2c_inst_t i2c0_inst;
+#define i2c0 (&i2c0_inst)
+
+#endif
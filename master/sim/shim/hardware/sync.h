@@ -0,0 +1,21 @@
+#ifndef SIM_HARDWARE_SYNC_H
+#define SIM_HARDWARE_SYNC_H
+
+/**
+ * RP2040 spin locks. Both slave cores run on the same host thread in the
+ * simulator, so a lock is never contended.
+*/
+
+#include <stdint.h>
+
+typedef volatile uint32_t spin_lock_t;
+
+int spin_lock_claim_unused(bool required);
+spin_lock_t *spin_lock_init(unsigned int lock_num);
+
+static inline void spin_lock_unsafe_blocking(spin_lock_t *lock) { *lock = 1; }
+static inline void spin_unlock_unsafe(spin_lock_t *lock) { *lock = 0; }
+
+static inline void __dmb() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef SIM_PGMSPACE_H
+#define SIM_PGMSPACE_H
+
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void * const *)(addr))
+#define strcpy_P(dest, src) strcpy((dest), (src))
+#define memcpy_P(dest, src, len) memcpy((dest), (src), (len))
+
+#endif
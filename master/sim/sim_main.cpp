@@ -0,0 +1,369 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include <TimeLib.h>
+#include <chrono>
+
+#include "animation_scheduler.h"
+#include "bus_manager.h"
+#include "choreography.h"
+#include "clock_config.h"
+#include "clock_manager.h"
+#include "sim_slave.h"
+#include "sim_time.h"
+#include "virtual_bus.h"
+
+// Slave STEPS / 360
+#define SIM_STEPS_PER_DEGREE 12
+// Slave INIT_HANDS_ANGLE
+#define SIM_INIT_HANDS_ANGLE 270
+// Period of the master loop while an animation plays
+#define SIM_LOOP_US 1000
+// Period of the master loop while nothing moves, transitions start
+// this close to when the master means them to
+#define SIM_IDLE_LOOP_US 10000
+// A transition still running after this is reported as stuck
+#define SIM_SETTLE_TIMEOUT_US (10 * 60 * 1000000ULL)
+
+static const t_sim_slave *_slaves[SIM_SLAVES_MAX];
+// Slaves on the bus, the others are never started
+static int _boards = DEFAULT_BOARDS;
+
+typedef struct sim_options
+{
+  int mode;
+  int boards;
+  int loss_board;
+  int loss_permille;
+  int corrupt_board;
+  int corrupt_permille;
+  int max_clock_khz;
+  int minutes;
+  int speed_multiplier;
+  int start_hour;
+  int start_minute;
+  bool fixed_boards;      // board count set like the boards setting, not scanned
+  bool verbose;
+} t_sim_options;
+
+void sim_register_slave(const t_sim_slave *slave)
+{
+  if (slave->index < SIM_SLAVES_MAX)
+    _slaves[slave->index] = slave;
+}
+
+const t_sim_slave *sim_get_slave(int index)
+{
+  return index >= 0 && index < SIM_SLAVES_MAX ? _slaves[index] : nullptr;
+}
+
+/**
+ * Runs core 1 of the slaves that are due, core 0 only runs on I2C events
+*/
+static void run_slaves()
+{
+  for (int i = 0; i < _boards; i++)
+    if (_slaves[i]->deadline() <= sim_now_us())
+      _slaves[i]->loop1();
+}
+
+static bool slaves_idle()
+{
+  for (int i = 0; i < _boards; i++)
+    if (!_slaves[i]->idle())
+      return false;
+  return true;
+}
+
+static uint64_t slaves_deadline()
+{
+  uint64_t deadline = SIM_NEVER;
+  for (int i = 0; i < _boards; i++)
+  {
+    uint64_t next = _slaves[i]->deadline();
+    deadline = next < deadline ? next : deadline;
+  }
+  return deadline;
+}
+
+/**
+ * One pass of what loop() does on the master, then time runs until the
+ * next one
+ * @param last_busy   set to the time if a slave is still moving
+*/
+static void run_master(uint64_t &last_busy)
+{
+  choreography_set_time(now());
+  choreography_loop();
+  bool busy = animation_running() || !slaves_idle();
+  sim_run_us(busy ? SIM_LOOP_US : SIM_IDLE_LOOP_US);
+  if (!slaves_idle())
+    last_busy = sim_now_us();
+}
+
+static int sanitize_angle(int angle)
+{
+  angle = angle % 360;
+  return angle < 0 ? 360 + angle : angle;
+}
+
+/**
+ * Checks every hand against the expected time, both the angle the slave
+ * believes in and the one its step count actually leads to
+ * @return number of wrong hands
+*/
+static int verify_hands(int h, int m, bool verbose)
+{
+  t_full_clock expected = get_clock_state_from_time(h, m);
+  int errors = 0;
+  for (int board = 0; board < _boards; board++)
+  {
+    t_half_digit half = get_full_half_digit(expected.digit[board / 2].halfs[board % 2]);
+    for (int motor = 0; motor < 6; motor++)
+    {
+      t_clock clock = half.clocks[motor / 2];
+      int angle = sanitize_angle(motor % 2 == 0 ? clock.angle_h : clock.angle_m);
+      int logical = _slaves[board]->hand_angle(motor);
+      long position = _slaves[board]->position(motor);
+      // Odd motors are mounted reversed, see board_begin()
+      long degrees = position / SIM_STEPS_PER_DEGREE;
+      int physical = sanitize_angle(motor % 2 == 0 ? SIM_INIT_HANDS_ANGLE - degrees : SIM_INIT_HANDS_ANGLE + degrees);
+      if (logical == angle && physical == angle && position % SIM_STEPS_PER_DEGREE == 0)
+        continue;
+      errors++;
+      if (verbose)
+        printf("%02d:%02d board %d motor %d: expected %d, slave %d, steps %ld (%d)\n",
+          h, m, board, motor, angle, logical, position, physical);
+    }
+  }
+  return errors;
+}
+
+static int parse_mode(const char *value)
+{
+  if (strcmp(value, "lazy") == 0)
+    return LAZY;
+  if (strcmp(value, "fun") == 0)
+    return FUN;
+  if (strcmp(value, "waves") == 0)
+    return WAVES;
+  return -1;
+}
+
+static bool parse_options(int argc, char **argv, t_sim_options &options)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (strcmp(arg, "-v") == 0)
+    {
+      options.verbose = true;
+      continue;
+    }
+    if (strcmp(arg, "-f") == 0)
+    {
+      options.fixed_boards = true;
+      continue;
+    }
+    if (!value)
+      return false;
+    i++;
+    if (strcmp(arg, "-m") == 0)
+      options.mode = parse_mode(value);
+    else if (strcmp(arg, "-b") == 0)
+      options.boards = atoi(value);
+    else if (strcmp(arg, "-l") == 0)
+    {
+      if (sscanf(value, "%d:%d", &options.loss_board, &options.loss_permille) != 2)
+        return false;
+    }
+    else if (strcmp(arg, "-c") == 0)
+    {
+      if (sscanf(value, "%d:%d", &options.corrupt_board, &options.corrupt_permille) != 2)
+        return false;
+    }
+    else if (strcmp(arg, "-k") == 0)
+      options.max_clock_khz = atoi(value);
+    else if (strcmp(arg, "-n") == 0)
+      options.minutes = atoi(value);
+    else if (strcmp(arg, "-s") == 0)
+      options.speed_multiplier = atoi(value);
+    else if (strcmp(arg, "-t") == 0)
+    {
+      if (sscanf(value, "%d:%d", &options.start_hour, &options.start_minute) != 2)
+        return false;
+    }
+    else
+      return false;
+  }
+  return options.mode >= 0 && options.minutes > 0 && options.speed_multiplier >= 1 &&
+    options.boards >= 1 && options.boards <= SIM_SLAVES_MAX && options.loss_board < options.boards &&
+    options.corrupt_board < options.boards &&
+    options.start_hour >= 0 && options.start_hour < 24 &&
+    options.start_minute >= 0 && options.start_minute < 60;
+}
+
+int main(int argc, char **argv)
+{
+  t_sim_options options = {LAZY, DEFAULT_BOARDS, -1, 0, -1, 0, 0, 60, 1, 0, 0, false, false};
+  if (!parse_options(argc, argv, options))
+  {
+    printf("usage: %s [-m lazy|fun|waves] [-b boards] [-l board:permille] [-c board:permille] [-k max clock kHz] [-n minutes] [-s speed multiplier] [-t hh:mm] [-f] [-v]\n", argv[0]);
+    return 2;
+  }
+  for (int i = 0; i < SIM_SLAVES_MAX; i++)
+  {
+    if (!_slaves[i])
+    {
+      printf("slave %d missing\n", i);
+      return 2;
+    }
+  }
+
+  Serial.setEnabled(options.verbose);
+  begin_config();
+  set_clock_mode(options.mode);
+  set_speed_multiplier(options.speed_multiplier);
+
+  Wire.begin();
+  _boards = options.boards;
+  for (int i = 0; i < _boards; i++)
+  {
+    _slaves[i]->setup();
+    _slaves[i]->setup1();
+  }
+  sim_set_handler(run_slaves, slaves_deadline);
+  if (discover_boards(options.fixed_boards ? _boards : 0) != _boards)
+  {
+    printf("scan found %d boards instead of %d\n", get_board_count(), _boards);
+    return 2;
+  }
+  virtual_bus_set_max_clock(options.max_clock_khz * 1000);
+  uint32_t bus_clock = select_bus_clock(0);
+  printf("bus clock: %u Hz\n", bus_clock);
+  // Clean wiring carries every clock, anything slower is a selection bug
+  if (options.max_clock_khz == 0 && bus_step_clock(bus_clock, true) != 0)
+  {
+    printf("bus clock not raised to the fastest one\n");
+    return 2;
+  }
+  if (options.loss_board >= 0)
+    virtual_bus_set_loss(options.loss_board + 1, options.loss_permille);
+  if (options.corrupt_board >= 0)
+    virtual_bus_set_corruption(options.corrupt_board + 1, options.corrupt_permille);
+
+  setTime(options.start_hour, options.start_minute, 0, 1, 1, 2025);
+  uint64_t minute_start = sim_now_us();
+  uint64_t last_busy = 0;
+  // When the hands were last checked
+  uint64_t checked = 0;
+
+  auto wall_start = std::chrono::steady_clock::now();
+  int errors = 0;
+  int stuck = 0;
+  int overruns = 0;
+  int landed = 0;
+  int64_t offset_total_us = 0;
+  int64_t latest_us = INT64_MIN;
+  int64_t earliest_us = INT64_MAX;
+
+  for (int n = 0; n < options.minutes; n++)
+  {
+    int h = hour();
+    int m = minute();
+
+    // The transition to this minute started before it, unless it is the first.
+    // The master is left alone once every step is out, it could start the
+    // next minute as soon as the hands stop
+    do
+      run_master(last_busy);
+    while (animation_running() && sim_now_us() - minute_start < SIM_SETTLE_TIMEOUT_US);
+    while (!slaves_idle() && sim_now_us() - minute_start < SIM_SETTLE_TIMEOUT_US)
+    {
+      sim_run_us(SIM_LOOP_US);
+      last_busy = sim_now_us();
+    }
+
+    if (!slaves_idle())
+    {
+      stuck++;
+      printf("%02d:%02d did not settle\n", h, m);
+    }
+    else
+    {
+      errors += verify_hands(h, m, options.verbose);
+      // Minutes whose digits did not change move nothing
+      if (n > 0 && last_busy > checked)
+      {
+        // When the last hand stopped, against the start of the minute
+        int64_t offset = (int64_t)last_busy - (int64_t)minute_start;
+        offset_total_us += offset;
+        latest_us = offset > latest_us ? offset : latest_us;
+        earliest_us = offset < earliest_us ? offset : earliest_us;
+        landed++;
+      }
+    }
+
+    checked = sim_now_us();
+
+    // Wait for the next minute, its transition starts on the way
+    minute_start += 60 * 1000000ULL;
+    while (minute_start <= sim_now_us())
+    {
+      overruns++;
+      minute_start += 60 * 1000000ULL;
+    }
+    while (sim_now_us() < minute_start)
+      run_master(last_busy);
+  }
+
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+  t_bus_stats bus = virtual_bus_stats();
+  printf("%d minutes simulated in %.2f s (%.0f minutes/s)\n",
+    options.minutes, wall, wall > 0 ? options.minutes / wall : 0.0);
+  if (landed > 0)
+    printf("transitions end %+.3f s from :00 on average, latest %+.3f s, earliest %+.3f s\n",
+      offset_total_us / 1e6 / landed, latest_us / 1e6, earliest_us / 1e6);
+  printf("transitions: %d overran the minute, %d stuck\n", overruns, stuck);
+  printf("bus: %u transactions, %u bytes, %.3f s busy, %u nacks\n",
+    bus.transactions, bus.bytes, bus.busy_us / 1e6, bus.nacks);
+
+  // Read back over the bus like a master would, after the bus stats were taken
+  uint64_t steps = 0;
+  uint32_t late = 0;
+  uint32_t late_max_us = 0;
+  uint32_t crc_errors = 0;
+  uint32_t length_errors = 0;
+  uint32_t duplicates = 0;
+  for (int i = 0; i < _boards; i++)
+  {
+    t_board_stats stats;
+    if (!read_board_stats(i, &stats))
+    {
+      printf("board %d stats unreadable\n", i);
+      continue;
+    }
+    crc_errors += stats.rx_crc_errors;
+    length_errors += stats.rx_length_errors;
+    duplicates += stats.rx_duplicates;
+    for (int m = 0; m < 6; m++)
+    {
+      steps += stats.steps[m];
+      for (int b = 0; b < STATS_LATENESS_BUCKETS; b++)
+        late += stats.late[m][b];
+      late_max_us = stats.late_max_us[m] > late_max_us ? stats.late_max_us[m] : late_max_us;
+    }
+  }
+  printf("steps: %llu, %u late, worst %u us\n", (unsigned long long)steps, late, late_max_us);
+  printf("frames dropped by the boards: %u crc, %u length, %u duplicates\n",
+    crc_errors, length_errors, duplicates);
+  for (int i = 0; i < _boards; i++)
+  {
+    t_board_health health = bus_health(i + 1);
+    if (health.retries || health.failures || health.retransmits)
+      printf("board %d: %u transfers, %u nacks, %u retries, %u lost, %u retransmits\n", i,
+        health.transfers, health.nacks, health.retries, health.failures, health.retransmits);
+  }
+  printf("hands: %d wrong\n", errors);
+  return errors == 0 && stuck == 0 ? 0 : 1;
+}
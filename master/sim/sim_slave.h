@@ -0,0 +1,38 @@
+#ifndef SIM_SLAVE_H
+#define SIM_SLAVE_H
+
+#include <stdint.h>
+
+// One per I2C address, MAX_BOARDS on the master
+#define SIM_SLAVES_MAX 15
+
+/**
+ * One simulated slave board. Every instance is the slave firmware compiled
+ * in its own namespace (see sim_slave.inc), so boards share no state.
+*/
+typedef struct sim_slave
+{
+  uint8_t index;                    // board index, I2C address - 1
+  void (*setup)();                  // core 0 setup
+  void (*setup1)();                 // core 1 setup
+  void (*loop1)();                  // core 1 loop, steppers
+  bool (*idle)();                   // no keyframe pending and no motor moving
+  uint64_t (*deadline)();           // next virtual time loop1 is needed at
+  int (*hand_angle)(int motor);     // angle the motor was last sent to
+  long (*position)(int motor);      // steps emitted by the step generator
+} t_sim_slave;
+
+/**
+ * Called by every slave instance at static initialization
+ * @param slave   slave description, must outlive the program
+*/
+void sim_register_slave(const t_sim_slave *slave);
+
+/**
+ * Gets a registered slave
+ * @param index   board index
+ * @return slave or nullptr if there is no such board
+*/
+const t_sim_slave *sim_get_slave(int index);
+
+#endif
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 0
+#define SIM_SLAVE_NAMESPACE sim_slave_0
+#include "sim_slave.inc"
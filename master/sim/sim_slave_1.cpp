@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 1
+#define SIM_SLAVE_NAMESPACE sim_slave_1
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 10
+#define SIM_SLAVE_NAMESPACE sim_slave_10
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 11
+#define SIM_SLAVE_NAMESPACE sim_slave_11
+#include "sim_slave.inc"
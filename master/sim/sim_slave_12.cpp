@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 12
+#define SIM_SLAVE_NAMESPACE sim_slave_12
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 13
+#define SIM_SLAVE_NAMESPACE sim_slave_13
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 14
+#define SIM_SLAVE_NAMESPACE sim_slave_14
+#include "sim_slave.inc"
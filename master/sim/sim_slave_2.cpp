@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 2
+#define SIM_SLAVE_NAMESPACE sim_slave_2
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 3
+#define SIM_SLAVE_NAMESPACE sim_slave_3
+#include "sim_slave.inc"
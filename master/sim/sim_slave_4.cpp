@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 4
+#define SIM_SLAVE_NAMESPACE sim_slave_4
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 5
+#define SIM_SLAVE_NAMESPACE sim_slave_5
+#include "sim_slave.inc"
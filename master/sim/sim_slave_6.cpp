@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 6
+#define SIM_SLAVE_NAMESPACE sim_slave_6
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 7
+#define SIM_SLAVE_NAMESPACE sim_slave_7
+#include "sim_slave.inc"
@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 8
+#define SIM_SLAVE_NAMESPACE sim_slave_8
+#include "sim_slave.inc"
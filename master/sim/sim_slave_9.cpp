@@ -0,0 +1,3 @@
+#define SIM_SLAVE_INDEX 9
+#define SIM_SLAVE_NAMESPACE sim_slave_9
+#include "sim_slave.inc"
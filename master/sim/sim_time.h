@@ -0,0 +1,50 @@
+#ifndef SIM_TIME_H
+#define SIM_TIME_H
+
+#include <stdint.h>
+
+// Returned by a deadline function when nothing is due
+#define SIM_NEVER UINT64_MAX
+
+/**
+ * Virtual time. The simulated slaves are not run on a fixed tick: each one
+ * tells when it next needs the CPU (its step rings drain or a keyframe is
+ * waiting) and time jumps straight there, so idle periods and slow moves
+ * cost nothing.
+*/
+
+/**
+ * Current virtual time
+ * @return microseconds since start
+*/
+uint64_t sim_now_us();
+
+/**
+ * Moves virtual time forward without running anything, used to skip idle
+ * periods
+ * @param us    microseconds
+*/
+void sim_advance_us(uint64_t us);
+
+/**
+ * Moves virtual time forward, running the handler at every deadline on
+ * the way. delay() and bus transfers end up here.
+ * @param us    microseconds
+*/
+void sim_run_us(uint64_t us);
+
+/**
+ * Runs the handler at every deadline until nothing is due anymore
+ * @param timeout_us    gives up after this much virtual time
+ * @return true if everything went idle
+*/
+bool sim_run_until_idle(uint64_t timeout_us);
+
+/**
+ * Sets what runs while time passes. The handler must not call delay().
+ * @param handler     called at each deadline
+ * @param deadline    earliest time the handler is needed, SIM_NEVER if idle
+*/
+void sim_set_handler(void (*handler)(), uint64_t (*deadline)());
+
+#endif
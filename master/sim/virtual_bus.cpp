@@ -0,0 +1,145 @@
+#include "virtual_bus.h"
+#include "sim_time.h"
+
+static TwoWire *_devices[VIRTUAL_BUS_MAX_DEVICES];
+static int _devices_count = 0;
+static uint32_t _frequency = 100000;
+// Transfers out of 1000 hit by noise above the max clock
+#define SIM_OVERCLOCK_PERMILLE 200
+static t_bus_stats _stats = {0, 0, 0, 0};
+static int _loss_permille[128];
+static int _corruption_permille[128];
+static uint32_t _max_clock = 0;
+static uint32_t _loss_seed = 1;
+
+// Same sequence on every run, failures can be replayed
+static uint32_t next_random()
+{
+  _loss_seed = _loss_seed * 1103515245 + 12345;
+  return _loss_seed >> 16;
+}
+
+static bool lose_transfer(uint8_t address)
+{
+  if (_loss_permille[address & 0x7F] == 0)
+    return false;
+  return (int)(next_random() % 1000) < _loss_permille[address & 0x7F];
+}
+
+/**
+ * Flips a random bit of a write, the slave still acks every byte
+ * @return data, or a corrupted copy in buffer
+*/
+static const uint8_t *corrupt_transfer(uint8_t address, const uint8_t *data, size_t len, uint8_t *buffer)
+{
+  int permille = _max_clock && _frequency > _max_clock ? SIM_OVERCLOCK_PERMILLE : _corruption_permille[address & 0x7F];
+  if (len == 0 || permille == 0 || (int)(next_random() % 1000) >= permille)
+    return data;
+  memcpy(buffer, data, len);
+  uint32_t bit = next_random() % (len * 8);
+  buffer[bit / 8] ^= 1 << (bit % 8);
+  return buffer;
+}
+
+/**
+ * Accounts a transfer: start, address byte, data bytes (9 clocks each
+ * with the ack) and stop
+*/
+static void account_transfer(size_t len, bool acked)
+{
+  uint64_t clocks = 2 + (1 + (acked ? len : 0)) * 9;
+  uint64_t us = (clocks * 1000000 + _frequency - 1) / _frequency;
+  _stats.transactions++;
+  _stats.busy_us += us;
+  if (acked)
+    _stats.bytes += len;
+  else
+    _stats.nacks++;
+  // Slaves keep stepping while the master holds the bus
+  sim_run_us(us);
+}
+
+void virtual_bus_attach(TwoWire *device)
+{
+  for (int i = 0; i < _devices_count; i++)
+    if (_devices[i] == device)
+      return;
+  if (_devices_count < VIRTUAL_BUS_MAX_DEVICES)
+    _devices[_devices_count++] = device;
+}
+
+void virtual_bus_set_clock(uint32_t frequency)
+{
+  if (frequency > 0)
+    _frequency = frequency;
+}
+
+void virtual_bus_set_loss(uint8_t address, int permille)
+{
+  _loss_permille[address & 0x7F] = permille;
+}
+
+void virtual_bus_set_corruption(uint8_t address, int permille)
+{
+  _corruption_permille[address & 0x7F] = permille;
+}
+
+void virtual_bus_set_max_clock(uint32_t frequency)
+{
+  _max_clock = frequency;
+}
+
+uint8_t virtual_bus_write(uint8_t address, const uint8_t *data, size_t len)
+{
+  bool acked = false;
+  if (lose_transfer(address))
+  {
+    account_transfer(len, false);
+    return 2;
+  }
+  for (int i = 0; i < _devices_count; i++)
+  {
+    if (_devices[i]->acks(address))
+    {
+      // Noise is on the receiver side, general calls included
+      uint8_t corrupted[SIM_WIRE_BUFFER_SIZE];
+      acked = true;
+      _devices[i]->deliver(corrupt_transfer(_devices[i]->address(), data, len, corrupted), len);
+    }
+  }
+  account_transfer(len, acked);
+  return acked ? 0 : 2;
+}
+
+size_t virtual_bus_read(uint8_t address, uint8_t *data, size_t len)
+{
+  size_t read = 0;
+  bool acked = false;
+  if (address != VIRTUAL_BUS_GENERAL_CALL && !lose_transfer(address))
+  {
+    for (int i = 0; i < _devices_count && !acked; i++)
+    {
+      if (_devices[i]->acks(address))
+      {
+        acked = true;
+        read = _devices[i]->respond(data, len);
+        // Reads are only hit by a clock too fast, the slave drives SDA
+        if (_max_clock && _frequency > _max_clock)
+        {
+          uint8_t corrupted[SIM_WIRE_BUFFER_SIZE];
+          const uint8_t *received = corrupt_transfer(address, data, read, corrupted);
+          if (received != data)
+            memcpy(data, received, read);
+        }
+      }
+    }
+  }
+  // The master clocks len bytes whatever the slave had to say
+  account_transfer(len, acked);
+  return read;
+}
+
+t_bus_stats virtual_bus_stats()
+{
+  return _stats;
+}
@@ -0,0 +1,74 @@
+#ifndef VIRTUAL_BUS_H
+#define VIRTUAL_BUS_H
+
+#include <Wire.h>
+
+#define VIRTUAL_BUS_MAX_DEVICES 16
+#define VIRTUAL_BUS_GENERAL_CALL 0
+
+typedef struct bus_stats
+{
+  uint32_t transactions;
+  uint32_t bytes;         // payload bytes, address bytes excluded
+  uint32_t nacks;
+  uint64_t busy_us;       // time the bus was held at the configured clock
+} t_bus_stats;
+
+/**
+ * In-process I2C bus. A write is delivered to the slave owning the address,
+ * or to every slave acking general calls when sent to address 0. Each
+ * transfer advances virtual time by its duration on the wire.
+*/
+
+/**
+ * Connects a slave, its address is read from Wire.begin(address)
+ * @param device    slave Wire instance
+*/
+void virtual_bus_attach(TwoWire *device);
+
+/**
+ * Sets the bus clock used to time transfers
+ * @param frequency   Hz
+*/
+void virtual_bus_set_clock(uint32_t frequency);
+
+/**
+ * Makes an address drop transfers at random, as a flaky board would
+ * @param address   7 bit address
+ * @param permille  transfers out of 1000 NACKed, 0 for none
+*/
+void virtual_bus_set_loss(uint8_t address, int permille);
+
+/**
+ * Makes writes received by a slave arrive with a bit flipped at random,
+ * as noise on a long bus would, general calls included
+ * @param address   7 bit slave address
+ * @param permille  writes out of 1000 corrupted, 0 for none
+*/
+void virtual_bus_set_corruption(uint8_t address, int permille);
+
+/**
+ * Sets the fastest clock the wiring carries cleanly, faster clocks get
+ * bits flipped in every direction
+ * @param frequency   Hz, 0 for no limit
+*/
+void virtual_bus_set_max_clock(uint32_t frequency);
+
+/**
+ * Master write
+ * @return Wire error code, 0 on success, 2 on address NACK
+*/
+uint8_t virtual_bus_write(uint8_t address, const uint8_t *data, size_t len);
+
+/**
+ * Master read
+ * @return bytes read
+*/
+size_t virtual_bus_read(uint8_t address, uint8_t *data, size_t len);
+
+/**
+ * @return counters since start
+*/
+t_bus_stats virtual_bus_stats();
+
+#endif
@@ -0,0 +1,53 @@
+#include "animation_scheduler.h"
+
+t_animation_step _steps[ANIMATION_MAX_STEPS];
+int _steps_count = 0;
+int _next_step = 0;
+unsigned long _animation_start = 0;
+void (*_on_cancel)() = NULL;
+
+void animation_start(const t_animation_step *steps, int count, void (*on_cancel)())
+{
+  animation_cancel();
+  if (count > ANIMATION_MAX_STEPS)
+    count = ANIMATION_MAX_STEPS;
+  memcpy(_steps, steps, count * sizeof(t_animation_step));
+  _steps_count = count;
+  _next_step = 0;
+  _on_cancel = on_cancel;
+  _animation_start = millis();
+  animation_update();
+}
+
+void animation_update()
+{
+  // Steps are run one at a time, a step can start or cancel an animation
+  while (_next_step < _steps_count)
+  {
+    t_animation_step step = _steps[_next_step];
+    unsigned long elapsed = millis() - _animation_start;
+    if (elapsed < step.at)
+    {
+      if (!step.ready || !step.ready())
+        break;
+      // Ready early, the rest of the animation follows
+      _animation_start -= step.at - elapsed;
+    }
+    _next_step++;
+    step.action(step.arg);
+  }
+}
+
+void animation_cancel()
+{
+  bool pending = animation_running();
+  _steps_count = 0;
+  _next_step = 0;
+  if (pending && _on_cancel)
+    _on_cancel();
+}
+
+bool animation_running()
+{
+  return _next_step < _steps_count;
+}
@@ -0,0 +1,143 @@
+#include <Arduino.h>
+#include <TimeLib.h>
+
+#include "animations.h"
+#include "animation_scheduler.h"
+#include "clock_manager.h"
+#include "clock_config.h"
+#include "timelines.h"
+
+int last_hour = -1;
+int last_minute = -1;
+bool is_stopped = false;
+
+static bool is_sleep_time(const tmElements_t &tm)
+{
+  int day_week = (tm.Wday + 5) % 7;
+  return get_sleep_time(day_week, tm.Hour);
+}
+
+/**
+ * Time the animation of the current mode takes to show a time, from the
+ * hands where they were last sent
+ * @return ms
+*/
+static unsigned long transition_duration(int h, int m)
+{
+  switch(get_clock_mode())
+  {
+    case LAZY:
+      return timeline_duration(timeline_lazy, TIMELINE_LENGTH(timeline_lazy), h, m);
+    case FUN:
+      return timeline_duration(timeline_fun, TIMELINE_LENGTH(timeline_fun), h, m);
+    case WAVES:
+      return timeline_duration(timeline_waves, TIMELINE_LENGTH(timeline_waves), h, m);
+  }
+  return 0;
+}
+
+// millis() when the hands are expected to stop
+static unsigned long settles_at = 0;
+
+static void show_time(int h, int m)
+{
+  is_stopped = false;
+  settles_at = millis() + transition_duration(h, m);
+  last_hour = h;
+  last_minute = m;
+  Serial.printf("Set time: %d:%d\n", h, m);
+  animation_cancel();
+  switch(get_clock_mode())
+  {
+    case LAZY:
+      set_lazy();
+      break;
+    case FUN:
+      set_fun();
+      break;
+    case WAVES:
+      set_waves();
+      break;
+  }
+}
+
+void set_time(time_t t, unsigned long since)
+{
+  // The time library cache is not shared with the network core
+  tmElements_t tm;
+  breakTime(t, tm);
+  tmElements_t next;
+  breakTime(t - tm.Second + SECS_PER_MIN, next);
+
+  if(is_sleep_time(tm))
+    stop();
+  else if(next.Hour == last_hour && next.Minute == last_minute)
+    return; // Started early, the minute has not begun yet
+  else if(tm.Hour != last_hour || tm.Minute != last_minute)
+    show_time(tm.Hour, tm.Minute);
+  else if(!is_sleep_time(next) && !animation_running() && (long)(millis() - settles_at) >= 0)
+  {
+    // Estimates start from the hands at rest, a transition still running
+    // is left to finish and the next one is late
+    // Estimated once a second, nothing moves while the clock waits
+    static time_t estimated = 0;
+    static unsigned long duration = 0;
+    long until = (SECS_PER_MIN - tm.Second) * 1000L - (long)(millis() - since);
+    if(until > PREROLL_MAX_MS)
+      return;
+    if(estimated != t)
+    {
+      estimated = t;
+      duration = transition_duration(next.Hour, next.Minute);
+      duration = duration < PREROLL_MAX_MS ? duration : PREROLL_MAX_MS;
+    }
+    if(until <= (long)duration)
+      show_time(next.Hour, next.Minute);
+  }
+}
+
+void set_lazy()
+{
+  timeline_play(timeline_lazy, TIMELINE_LENGTH(timeline_lazy), last_hour, last_minute);
+}
+
+void set_fun()
+{
+  timeline_play(timeline_fun, TIMELINE_LENGTH(timeline_fun), last_hour, last_minute);
+}
+
+void set_waves()
+{
+  timeline_play(timeline_waves, TIMELINE_LENGTH(timeline_waves), last_hour, last_minute);
+}
+
+void stop()
+{
+  if(!is_stopped)
+  {
+    is_stopped = true;
+    last_hour = -1;
+    last_minute = -1;
+    animation_cancel();
+    set_direction(MIN_DISTANCE);
+    set_speed(200 * get_speed_multiplier());
+    set_acceleration(100 * get_speed_multiplier());
+    set_clock(d_stop);
+  }
+}
+
+void shutdown()
+{
+  set_clock_mode_temp(OFF);
+  if(!is_stopped)
+  {
+    is_stopped = true;
+    last_hour = -1;
+    last_minute = -1;
+    animation_cancel();
+    set_direction(MIN_DISTANCE);
+    set_speed(200 * 100);
+    set_acceleration(100 * 100);
+    set_clock(d_stop);
+  }
+}
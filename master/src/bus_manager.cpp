@@ -0,0 +1,208 @@
+#include <Wire.h>
+#include "bus_manager.h"
+
+// Wire error codes
+#define WIRE_OK 0
+#define WIRE_NACK_ADDRESS 2
+#define WIRE_NACK_DATA 3
+#define WIRE_OTHER 4
+
+typedef struct bus_transfer
+{
+  uint8_t address;
+  const uint8_t *data;  // bytes to write
+  uint8_t *buffer;      // bytes read, NULL for a write
+  size_t len;
+} t_bus_transfer;
+
+// Indexed by address, 0 is the general call
+t_board_health _health[MAX_BOARDS + 1] = {};
+// Collects the counters of addresses past MAX_BOARDS
+t_board_health _health_other = {};
+unsigned long _last_rescan = 0;
+const uint32_t _clocks[] = BUS_CLOCKS;
+uint32_t _clock = BUS_CLOCK_SLOWEST;
+// Counters of each address when the error window started
+uint32_t _window_transfers[MAX_BOARDS + 1] = {0};
+uint32_t _window_errors[MAX_BOARDS + 1] = {0};
+
+static t_board_health &health_of(uint8_t address)
+{
+  return address <= MAX_BOARDS ? _health[address] : _health_other;
+}
+
+static uint8_t transfer_once(const t_bus_transfer &transfer)
+{
+  if (!transfer.buffer)
+  {
+    Wire.beginTransmission(transfer.address);
+    Wire.write(transfer.data, transfer.len);
+    return Wire.endTransmission();
+  }
+
+  size_t got = Wire.requestFrom(transfer.address, (uint8_t)transfer.len);
+  for (size_t i = 0; i < got; i++)
+    transfer.buffer[i] = Wire.read();
+  // A read has no error code, nothing at all is most likely a NACK
+  return got == transfer.len ? WIRE_OK : got == 0 ? WIRE_NACK_ADDRESS : WIRE_OTHER;
+}
+
+static bool transfer(const t_bus_transfer &transfer)
+{
+  t_board_health &health = health_of(transfer.address);
+  // A board that went missing gets a single attempt until it answers again
+  int attempts = health.present || transfer.address == I2C_GENERAL_CALL ? BUS_ATTEMPTS : 1;
+  unsigned long backoff = BUS_BACKOFF_US;
+
+  for (int attempt = 0; attempt < attempts; attempt++)
+  {
+    if (attempt > 0)
+    {
+      health.retries++;
+      delayMicroseconds(backoff);
+      backoff = backoff * 2 < BUS_BACKOFF_MAX_US ? backoff * 2 : BUS_BACKOFF_MAX_US;
+    }
+
+    unsigned long start = micros();
+    uint8_t error = transfer_once(transfer);
+    uint32_t elapsed = micros() - start;
+    if (error == WIRE_OK)
+    {
+      health.present = true;
+      health.transfers++;
+      health.latency_us = health.transfers == 1 ? elapsed : (health.latency_us * 7 + elapsed) / 8;
+      if (elapsed > health.latency_max_us)
+        health.latency_max_us = elapsed;
+      return true;
+    }
+    if (error == WIRE_NACK_ADDRESS || error == WIRE_NACK_DATA)
+      health.nacks++;
+    else
+      health.timeouts++;
+  }
+
+  health.present = false;
+  health.failures++;
+  return false;
+}
+
+bool bus_write(uint8_t address, const uint8_t *data, size_t len)
+{
+  return transfer({address, data, NULL, len});
+}
+
+bool bus_read(uint8_t address, uint8_t *buffer, size_t len)
+{
+  return transfer({address, NULL, buffer, len});
+}
+
+bool bus_probe(uint8_t address)
+{
+  Wire.beginTransmission(address);
+  bool present = Wire.endTransmission() == WIRE_OK;
+  health_of(address).present = present;
+  return present;
+}
+
+uint16_t bus_rescan()
+{
+  if (millis() - _last_rescan < BUS_RESCAN_INTERVAL)
+    return 0;
+  _last_rescan = millis();
+
+  uint16_t back = 0;
+  for (int i = 0; i < MAX_BOARDS; i++)
+  {
+    bool was_present = _health[i + 1].present;
+    if (bus_probe(i + 1) && !was_present)
+      back |= 1 << i;
+  }
+  return back;
+}
+
+void bus_set_clock(uint32_t frequency)
+{
+  Wire.setClock(frequency);
+  _clock = frequency;
+}
+
+uint32_t bus_get_clock()
+{
+  return _clock;
+}
+
+uint32_t bus_step_clock(uint32_t frequency, bool faster)
+{
+  const int count = sizeof(_clocks) / sizeof(_clocks[0]);
+  if (faster)
+  {
+    for (int i = 0; i < count; i++)
+      if (_clocks[i] > frequency)
+        return _clocks[i];
+  }
+  else
+  {
+    for (int i = count - 1; i >= 0; i--)
+      if (_clocks[i] < frequency)
+        return _clocks[i];
+  }
+  return 0;
+}
+
+static uint32_t errors_of(const t_board_health &health)
+{
+  return health.nacks + health.timeouts + health.retransmits;
+}
+
+bool bus_errors_rising()
+{
+  // Boards that went missing would count as a bad bus, their window
+  // starts over until they answer again
+  uint32_t transfers = 0;
+  uint32_t errors = 0;
+  for (int i = 1; i <= MAX_BOARDS; i++)
+  {
+    if (!_health[i].present)
+    {
+      _window_transfers[i] = _health[i].transfers;
+      _window_errors[i] = errors_of(_health[i]);
+      continue;
+    }
+    transfers += _health[i].transfers - _window_transfers[i];
+    errors += errors_of(_health[i]) - _window_errors[i];
+  }
+  if (transfers < BUS_CLOCK_WINDOW)
+    return false;
+
+  for (int i = 1; i <= MAX_BOARDS; i++)
+  {
+    _window_transfers[i] = _health[i].transfers;
+    _window_errors[i] = errors_of(_health[i]);
+  }
+  return errors * 1000 > transfers * BUS_CLOCK_ERROR_PERMILLE;
+}
+
+void bus_record_retransmit(uint8_t address)
+{
+  health_of(address).retransmits++;
+}
+
+t_board_health bus_health(uint8_t address)
+{
+  return health_of(address);
+}
+
+size_t bus_health_json(char *buffer, size_t size, uint8_t address)
+{
+  t_board_health health = health_of(address);
+  int len = snprintf(buffer, size,
+    "{\"address\":%d,\"present\":%s,\"transfers\":%lu,\"nacks\":%lu,\"timeouts\":%lu,"
+    "\"retries\":%lu,\"failures\":%lu,\"retransmits\":%lu,\"latency_us\":%lu,\"latency_max_us\":%lu}",
+    address, health.present ? "true" : "false",
+    (unsigned long)health.transfers, (unsigned long)health.nacks,
+    (unsigned long)health.timeouts, (unsigned long)health.retries,
+    (unsigned long)health.failures, (unsigned long)health.retransmits,
+    (unsigned long)health.latency_us,
+    (unsigned long)health.latency_max_us);
+  return len < 0 ? 0 : (size_t)len < size ? len : size - 1;
+}
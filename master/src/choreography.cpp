@@ -0,0 +1,152 @@
+#include "choreography.h"
+#include "animations.h"
+#include "animation_scheduler.h"
+#include "clock_manager.h"
+#include "clock_config.h"
+
+enum command_types
+{
+  CMD_TIME,
+  CMD_ADJUST,
+  CMD_SHUTDOWN
+};
+
+typedef struct command
+{
+  uint8_t type;
+  time_t time;
+  int16_t clock_index;
+  int16_t h_amount;
+  int16_t m_amount;
+  unsigned long since;    // millis() when time began
+} t_command;
+
+time_t _submitted_time = 0;
+time_t _clock_time = 0;
+unsigned long _clock_since = 0;
+
+#ifdef CHOREOGRAPHY_TASK
+/**
+ * Lock-free single producer single consumer ring of commands.
+ * The producer (network task) only writes head, the consumer
+ * (choreography task) only writes tail.
+*/
+typedef struct command_queue
+{
+  t_command commands[CHOREOGRAPHY_QUEUE_SIZE];
+  uint32_t head;
+  uint32_t tail;
+} t_command_queue;
+
+t_command_queue _commands;
+TaskHandle_t _choreography_task = NULL;
+
+static bool command_queue_push(t_command_queue *queue, const t_command *command)
+{
+  uint32_t head = queue->head;
+  uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+  if (head - tail >= CHOREOGRAPHY_QUEUE_SIZE)
+    return false;
+
+  queue->commands[head & (CHOREOGRAPHY_QUEUE_SIZE - 1)] = *command;
+  // Publish the slot only once it is completely written
+  __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+static bool command_queue_pop(t_command_queue *queue, t_command *command)
+{
+  uint32_t tail = queue->tail;
+  uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+  if (head == tail)
+    return false;
+
+  *command = queue->commands[tail & (CHOREOGRAPHY_QUEUE_SIZE - 1)];
+  // Hand the slot back only once it has been copied out
+  __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+#endif
+
+static void run_command(const t_command &command)
+{
+  switch (command.type)
+  {
+    case CMD_TIME:
+      _clock_time = command.time;
+      _clock_since = command.since;
+      break;
+    case CMD_ADJUST:
+      // Adjustments are relative to what the boards were sent, drop
+      // the frames a running timeline has prepared but not sent yet
+      animation_cancel();
+      adjust_hands(command.clock_index, command.h_amount, command.m_amount);
+      break;
+    case CMD_SHUTDOWN:
+      shutdown();
+      break;
+  }
+}
+
+static void submit(const t_command &command)
+{
+#ifdef CHOREOGRAPHY_TASK
+  // The choreography drains the queue every tick, waiting is short
+  while (!command_queue_push(&_commands, &command))
+    vTaskDelay(1);
+#else
+  run_command(command);
+#endif
+}
+
+#ifdef CHOREOGRAPHY_TASK
+static void choreography_task(void *param)
+{
+  for (;;)
+  {
+    choreography_loop();
+    vTaskDelay(1);
+  }
+}
+#endif
+
+void choreography_begin()
+{
+#ifdef CHOREOGRAPHY_TASK
+  xTaskCreatePinnedToCore(choreography_task, "choreography", CHOREOGRAPHY_TASK_STACK,
+    NULL, CHOREOGRAPHY_TASK_PRIORITY, &_choreography_task, CHOREOGRAPHY_CORE);
+#endif
+}
+
+void choreography_loop()
+{
+#ifdef CHOREOGRAPHY_TASK
+  t_command command;
+  while (command_queue_pop(&_commands, &command))
+    run_command(command);
+#endif
+
+  get_clock_mode() != OFF ? set_time(_clock_time, _clock_since) : stop();
+  animation_update();
+  if (!animation_running())
+    check_boards();
+}
+
+void choreography_set_time(time_t t)
+{
+  if (t == _submitted_time)
+    return;
+  _submitted_time = t;
+  // Called every loop, a new second is seen within a loop of starting
+  submit({CMD_TIME, t, 0, 0, 0, millis()});
+}
+
+void choreography_adjust(int clock_index, int h_amount, int m_amount)
+{
+  submit({CMD_ADJUST, 0, (int16_t)clock_index, (int16_t)h_amount, (int16_t)m_amount});
+}
+
+void choreography_shutdown()
+{
+  submit({CMD_SHUTDOWN, 0, 0, 0, 0});
+}
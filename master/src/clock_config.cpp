@@ -1,80 +1,177 @@
 #include "clock_config.h"
+#include "clock_state.h"
+#include "time_zone.h"
+
+/**
+ * Everything saved, written to flash as one blob. A new field goes at the
+ * end, with a new CONFIG_VERSION.
+ */
+typedef struct __attribute__((packed)) config
+{
+  uint8_t version;
+  uint8_t clock_mode;
+  bool clock_enabled;
+  uint8_t wireless_mode;
+  int32_t speed_multiplier;
+  uint8_t boards;                 // 0 to scan the bus
+  uint32_t bus_clock;             // 0 for no limit
+  uint16_t mqtt_port;
+  bool mqtt_enabled;
+  bool daily_restart_enabled;
+  uint8_t daily_restart_hour;
+  uint8_t sleep_time[7 * 24 / 8]; // a bit per hour
+  char timezone[TZ_STRING_SIZE];
+  char ssid[64];
+  char password[64];
+  char hostname[64];
+  char mqtt_broker[64];
+  char mqtt_username[64];
+  char mqtt_password[64];
+} t_config;
+
+// Keys of the settings before they were kept in one blob
+const char *_legacy_keys[] = {
+  "clock_mode", "clock_enabled", "wireless_mode", "clock_tz", "clock_timezone",
+  "speed_mult", "boards", "bus_clock", "ssid", "password", "hostname",
+  "mqtt_broker", "mqtt_port", "mqtt_user", "mqtt_pass", "mqtt_enabled",
+  "daily_restart_en", "daily_restart_hr", "sleep_time"
+};
 
 // Non volatile preferences
 Preferences prefs;
 
-// Internal config state
+// Saved config state
+t_config _config;
+// Set by the setters, which may run on another task, and cleared before
+// the blob is written so a change made meanwhile is written again
+bool _config_dirty = false;
+unsigned long _config_changed_at = 0;
+unsigned long _config_dirty_since = 0;
+
+// Runtime state, the clock can be stopped without saving it
 int _clock_mode;
 bool _clock_enabled = true;
-bool _sleep_time[7 * 24];
-int _clock_timezone;
-int _speed_multiplier = 1;
-
-int _wireless_mode;
 int _active_wireless_mode; // Runtime connection mode (may differ from configured mode)
-char _ssid[64];
-char _password[64];
-char _hostname[64];
 
-// MQTT configuration
-char _mqtt_broker[64];
-int _mqtt_port = 1883;
-char _mqtt_username[64];
-char _mqtt_password[64];
-bool _mqtt_enabled = false;
-
-// Daily restart configuration
-bool _daily_restart_enabled = true;
-int _daily_restart_hour = 5; // 5 AM
+static void copy_string(char *destination, const char *value, size_t size)
+{
+  strncpy(destination, value ? value : "", size - 1);
+  destination[size - 1] = '\0';
+}
+
+static void mark_dirty()
+{
+  unsigned long now = millis();
+  _config_changed_at = now;
+  if (!__atomic_load_n(&_config_dirty, __ATOMIC_ACQUIRE))
+    _config_dirty_since = now;
+  __atomic_store_n(&_config_dirty, true, __ATOMIC_RELEASE);
+}
+
+static void default_config(t_config *config)
+{
+  memset(config, 0, sizeof(t_config));
+  config->version = CONFIG_VERSION;
+  config->clock_mode = LAZY;
+  config->clock_enabled = true;
+  config->wireless_mode = HOTSPOT;
+  config->speed_multiplier = 1;
+  config->mqtt_port = 1883;
+  config->daily_restart_enabled = true;
+  config->daily_restart_hour = 5; // 5 AM
+  copy_string(config->timezone, TZ_DEFAULT, sizeof(config->timezone));
+  copy_string(config->hostname, "clockclock24", sizeof(config->hostname));
+}
+
+/**
+ * Reads the settings of older firmware, one key each
+*/
+static void load_legacy_config(t_config *config)
+{
+  config->clock_mode = prefs.getInt("clock_mode", LAZY);
+  config->clock_enabled = prefs.getBool("clock_enabled", true);
+  config->wireless_mode = prefs.getInt("wireless_mode", HOTSPOT);
+  if(prefs.isKey("clock_tz"))
+    copy_string(config->timezone, prefs.getString("clock_tz", TZ_DEFAULT).c_str(), sizeof(config->timezone));
+  else // Whole hours east of UTC, before POSIX TZ strings
+    tz_fixed(prefs.getInt("clock_timezone", 0) * 60, config->timezone);
+  config->speed_multiplier = prefs.getInt("speed_mult", 1);
+  config->boards = prefs.getInt("boards", 0);
+  config->bus_clock = prefs.getUInt("bus_clock", 0);
+  copy_string(config->ssid, prefs.getString("ssid", "").c_str(), sizeof(config->ssid));
+  copy_string(config->password, prefs.getString("password", "").c_str(), sizeof(config->password));
+  copy_string(config->hostname, prefs.getString("hostname", "clockclock24").c_str(), sizeof(config->hostname));
+  copy_string(config->mqtt_broker, prefs.getString("mqtt_broker", "").c_str(), sizeof(config->mqtt_broker));
+  config->mqtt_port = prefs.getInt("mqtt_port", 1883);
+  copy_string(config->mqtt_username, prefs.getString("mqtt_user", "").c_str(), sizeof(config->mqtt_username));
+  copy_string(config->mqtt_password, prefs.getString("mqtt_pass", "").c_str(), sizeof(config->mqtt_password));
+  config->mqtt_enabled = prefs.getBool("mqtt_enabled", false);
+  config->daily_restart_enabled = prefs.getBool("daily_restart_en", true);
+  config->daily_restart_hour = prefs.getInt("daily_restart_hr", 5);
+  bool sleep_time[7 * 24];
+  if(prefs.isKey("sleep_time") && prefs.getBytes("sleep_time", sleep_time, sizeof(sleep_time)) == sizeof(sleep_time))
+    for (int i = 0; i < 7 * 24; i++)
+      if (sleep_time[i])
+        config->sleep_time[i / 8] |= 1 << (i % 8);
+}
 
 void begin_config()
 {
   prefs.begin("clockclock24");
-  _clock_mode = prefs.getInt("clock_mode", LAZY);
-  _clock_enabled = prefs.getBool("clock_enabled", true);
-  _wireless_mode = prefs.getInt("wireless_mode", HOTSPOT);
-  _active_wireless_mode = _wireless_mode;
-  _clock_timezone = prefs.getInt("clock_timezone", 0);
-  _speed_multiplier = prefs.getInt("speed_mult", 1);
-  strncpy(_ssid, prefs.getString("ssid", "").c_str(), sizeof(_ssid));
-  strncpy(_password, prefs.getString("password", "").c_str(), sizeof(_password));
-  strncpy(_hostname, prefs.getString("hostname", "clockclock24").c_str(), sizeof(_hostname));
-  strncpy(_mqtt_broker, prefs.getString("mqtt_broker", "").c_str(), sizeof(_mqtt_broker));
-  _mqtt_port = prefs.getInt("mqtt_port", 1883);
-  strncpy(_mqtt_username, prefs.getString("mqtt_user", "").c_str(), sizeof(_mqtt_username));
-  strncpy(_mqtt_password, prefs.getString("mqtt_pass", "").c_str(), sizeof(_mqtt_password));
-  _mqtt_enabled = prefs.getBool("mqtt_enabled", false);
-  _daily_restart_enabled = prefs.getBool("daily_restart_en", true);
-  _daily_restart_hour = prefs.getInt("daily_restart_hr", 5);
-  if(prefs.isKey("sleep_time"))
-    prefs.getBytes("sleep_time", _sleep_time, sizeof(_sleep_time));
-  else
-    memset(_sleep_time, 0, sizeof(_sleep_time));
+  default_config(&_config);
+  if(!prefs.isKey("config"))
+  {
+    // Saved once as a blob, then the old keys go
+    load_legacy_config(&_config);
+    mark_dirty();
+    flush_config();
+    for (const char *key : _legacy_keys)
+      if(prefs.isKey(key))
+        prefs.remove(key);
+  }
+  else if(prefs.getBytesLength("config") != sizeof(t_config) ||
+          prefs.getBytes("config", &_config, sizeof(t_config)) != sizeof(t_config) ||
+          _config.version != CONFIG_VERSION)
+  {
+    Serial.println("Saved config not supported, defaults loaded");
+    default_config(&_config);
+  }
+  _clock_mode = _config.clock_mode;
+  _clock_enabled = _config.clock_enabled;
+  _active_wireless_mode = _config.wireless_mode;
 }
 
 void end_config()
 {
+  flush_config();
   prefs.end();
 }
 
 void clear_config()
 {
   prefs.clear();
-  _clock_mode = LAZY;
-  _clock_enabled = true;
-  _wireless_mode = HOTSPOT;
-  _speed_multiplier = 1;
-  strncpy(_ssid, "", sizeof(_ssid));
-  strncpy(_password, "", sizeof(_password));
-  strncpy(_hostname, "clockclock24", sizeof(_hostname));
-  strncpy(_mqtt_broker, "", sizeof(_mqtt_broker));
-  _mqtt_port = 1883;
-  strncpy(_mqtt_username, "", sizeof(_mqtt_username));
-  strncpy(_mqtt_password, "", sizeof(_mqtt_password));
-  _mqtt_enabled = false;
-  _daily_restart_enabled = true;
-  _daily_restart_hour = 5;
-  memset(_sleep_time, 0, sizeof(_sleep_time));
+  __atomic_store_n(&_config_dirty, false, __ATOMIC_RELEASE);
+  default_config(&_config);
+  _clock_mode = _config.clock_mode;
+  _clock_enabled = _config.clock_enabled;
+}
+
+void update_config()
+{
+  if (!__atomic_load_n(&_config_dirty, __ATOMIC_ACQUIRE))
+    return;
+  unsigned long now = millis();
+  if (now - _config_changed_at >= CONFIG_WRITE_DELAY_MS ||
+      now - _config_dirty_since >= CONFIG_WRITE_MAX_DELAY_MS)
+    flush_config();
+}
+
+void flush_config()
+{
+  if (!__atomic_exchange_n(&_config_dirty, false, __ATOMIC_ACQ_REL))
+    return;
+  if (prefs.putBytes("config", &_config, sizeof(t_config)) != sizeof(t_config))
+    Serial.println("Config write failed");
 }
 
 int get_clock_mode()
@@ -95,12 +192,13 @@ bool get_clock_enabled()
 
 bool get_sleep_time(int day, int hour)
 {
-  return _sleep_time[(day * 24) + (hour % 24)];
+  int i = (day * 24) + (hour % 24);
+  return _config.sleep_time[i / 8] & (1 << (i % 8));
 }
 
 int get_connection_mode()
 {
-  return _wireless_mode;
+  return _config.wireless_mode;
 }
 
 int get_active_connection_mode()
@@ -108,54 +206,54 @@ int get_active_connection_mode()
   return _active_wireless_mode;
 }
 
-int get_timezone()
+const char *get_timezone()
 {
-  return _clock_timezone;
+  return _config.timezone;
 }
 
 char *get_ssid()
 {
-  return _ssid;
+  return _config.ssid;
 }
 
 char *get_password()
 {
-  return _password;
+  return _config.password;
 }
 
 char *get_hostname()
 {
-  return _hostname;
+  return _config.hostname;
 }
 
 char *get_mqtt_broker()
 {
-  return _mqtt_broker;
+  return _config.mqtt_broker;
 }
 
 int get_mqtt_port()
 {
-  return _mqtt_port;
+  return _config.mqtt_port;
 }
 
 char *get_mqtt_username()
 {
-  return _mqtt_username;
+  return _config.mqtt_username;
 }
 
 char *get_mqtt_password()
 {
-  return _mqtt_password;
+  return _config.mqtt_password;
 }
 
 bool get_mqtt_enabled()
 {
-  return _mqtt_enabled;
+  return _config.mqtt_enabled;
 }
 
 int get_speed_multiplier()
 {
-  return _speed_multiplier;
+  return _config.speed_multiplier;
 }
 
 void set_clock_mode(int value)
@@ -163,13 +261,14 @@ void set_clock_mode(int value)
   // Handle OFF as a special case - disable the clock
   if (value == OFF) {
     _clock_enabled = false;
-    prefs.putBool("clock_enabled", false);
+    _config.clock_enabled = false;
   } else {
     _clock_mode = value;
     _clock_enabled = true;
-    prefs.putInt("clock_mode", value);
-    prefs.putBool("clock_enabled", true);
+    _config.clock_mode = value;
+    _config.clock_enabled = true;
   }
+  mark_dirty();
 }
 
 void set_clock_mode_temp(int value)
@@ -187,31 +286,37 @@ void set_clock_animation_mode(int value)
 {
   if (value >= LAZY && value <= WAVES) {
     _clock_mode = value;
-    prefs.putInt("clock_mode", value);
+    _config.clock_mode = value;
+    mark_dirty();
   }
 }
 
 void set_clock_enabled(bool value)
 {
   _clock_enabled = value;
-  prefs.putBool("clock_enabled", value);
+  _config.clock_enabled = value;
+  mark_dirty();
 }
 
 void set_sleep_time(int day, int hour, bool value)
 {
-  _sleep_time[(day * 24) + (hour % 24)] = value;
+  int i = (day * 24) + (hour % 24);
+  if (value)
+    _config.sleep_time[i / 8] |= 1 << (i % 8);
+  else
+    _config.sleep_time[i / 8] &= ~(1 << (i % 8));
 }
 
 void save_sleep_time()
 {
-  prefs.putBytes("sleep_time", _sleep_time, sizeof(_sleep_time));
+  mark_dirty();
 }
 
 void set_connection_mode(int value)
 {
-  _wireless_mode = value;
+  _config.wireless_mode = value;
   _active_wireless_mode = value;
-  prefs.putInt("wireless_mode", value);
+  mark_dirty();
 }
 
 void set_active_connection_mode(int value)
@@ -219,89 +324,114 @@ void set_active_connection_mode(int value)
   _active_wireless_mode = value;
 }
 
-void set_timezone(int value)
+void set_timezone(const char *value)
 {
-  _clock_timezone = value;
-  prefs.putInt("clock_timezone", value);
+  copy_string(_config.timezone, value, sizeof(_config.timezone));
+  mark_dirty();
 }
 
 void set_ssid(const char *value)
 {
-  strncpy(_ssid, value, sizeof(_ssid));
-  prefs.putString("ssid", value);
+  copy_string(_config.ssid, value, sizeof(_config.ssid));
+  mark_dirty();
 }
 
 void set_password(const char *value)
 {
-  strncpy(_password, value, sizeof(_password));
-  prefs.putString("password", value);
+  copy_string(_config.password, value, sizeof(_config.password));
+  mark_dirty();
 }
 
 void set_hostname(const char *value)
 {
   // Use default if empty
   const char *hostname = (value && strlen(value) > 0) ? value : "clockclock24";
-  strncpy(_hostname, hostname, sizeof(_hostname));
-  prefs.putString("hostname", hostname);
+  copy_string(_config.hostname, hostname, sizeof(_config.hostname));
+  mark_dirty();
 }
 
 void set_mqtt_broker(const char *value)
 {
-  strncpy(_mqtt_broker, value, sizeof(_mqtt_broker));
-  prefs.putString("mqtt_broker", value);
+  copy_string(_config.mqtt_broker, value, sizeof(_config.mqtt_broker));
+  mark_dirty();
 }
 
 void set_mqtt_port(int value)
 {
-  _mqtt_port = value;
-  prefs.putInt("mqtt_port", value);
+  _config.mqtt_port = value;
+  mark_dirty();
 }
 
 void set_mqtt_username(const char *value)
 {
-  strncpy(_mqtt_username, value, sizeof(_mqtt_username));
-  prefs.putString("mqtt_user", value);
+  copy_string(_config.mqtt_username, value, sizeof(_config.mqtt_username));
+  mark_dirty();
 }
 
 void set_mqtt_password(const char *value)
 {
-  strncpy(_mqtt_password, value, sizeof(_mqtt_password));
-  prefs.putString("mqtt_pass", value);
+  copy_string(_config.mqtt_password, value, sizeof(_config.mqtt_password));
+  mark_dirty();
 }
 
 void set_mqtt_enabled(bool value)
 {
-  _mqtt_enabled = value;
-  prefs.putBool("mqtt_enabled", value);
+  _config.mqtt_enabled = value;
+  mark_dirty();
 }
 
 void set_speed_multiplier(int value)
 {
   if(value >= 1)
   {
-    _speed_multiplier = value;
-    prefs.putInt("speed_mult", value);
+    _config.speed_multiplier = value;
+    mark_dirty();
   }
 }
 
+int get_boards()
+{
+  return _config.boards;
+}
+
+void set_boards(int value)
+{
+  if(value >= 0 && value <= MAX_BOARDS)
+  {
+    _config.boards = value;
+    mark_dirty();
+  }
+}
+
+uint32_t get_bus_clock()
+{
+  return _config.bus_clock;
+}
+
+void set_bus_clock(uint32_t value)
+{
+  _config.bus_clock = value;
+  mark_dirty();
+}
+
 bool get_daily_restart_enabled()
 {
-  return _daily_restart_enabled;
+  return _config.daily_restart_enabled;
 }
 
 int get_daily_restart_hour()
 {
-  return _daily_restart_hour;
+  return _config.daily_restart_hour;
 }
 
 void set_daily_restart_enabled(bool value)
 {
-  _daily_restart_enabled = value;
-  prefs.putBool("daily_restart_en", value);
+  _config.daily_restart_enabled = value;
+  mark_dirty();
 }
 
 void set_daily_restart_hour(int value)
 {
-  _daily_restart_hour = (value >= 0 && value <= 23) ? value : 5;
-  prefs.putInt("daily_restart_hr", _daily_restart_hour);
-}
\ No newline at end of file
+  _config.daily_restart_hour = (value >= 0 && value <= 23) ? value : 5;
+  mark_dirty();
+}
@@ -0,0 +1,163 @@
+#include "clock_discipline.h"
+
+t_ntp_sample _samples[DISCIPLINE_BURST];
+int _sample_count = 0;
+
+bool _disciplined = false;
+// Time at the last sync, the clock runs from there
+unsigned long _base_millis = 0;
+int64_t _base_ms = 0;
+// First sync of the drift measurement
+unsigned long _drift_base_millis = 0;
+int64_t _drift_base_ms = 0;
+int32_t _drift_ppb = 0;
+bool _drift_known = false;
+// Offset of the last sync, worked in gradually over the poll interval
+int64_t _slew_ms = 0;
+int64_t _slew_span_ms = 0;
+uint32_t _poll = DISCIPLINE_MIN_POLL;
+
+void discipline_add_sample(const t_ntp_sample &sample)
+{
+  if (_sample_count < DISCIPLINE_BURST)
+    _samples[_sample_count++] = sample;
+}
+
+int discipline_samples()
+{
+  return _sample_count;
+}
+
+/**
+ * Round trip on the network, the time the server held the request left out
+ * @return ms
+*/
+static int64_t sample_delay(const t_ntp_sample &sample)
+{
+  int64_t delay = (int64_t)(sample.received - sample.sent) - (sample.server_tx - sample.server_rx);
+  return delay > 0 ? delay : 0;
+}
+
+static int64_t abs64(int64_t value)
+{
+  return value < 0 ? -value : value;
+}
+
+static void restart(unsigned long at, int64_t ms)
+{
+  _base_millis = at;
+  _base_ms = ms;
+  _drift_base_millis = at;
+  _drift_base_ms = ms;
+  _drift_ppb = 0;
+  _drift_known = false;
+  _slew_ms = 0;
+  _slew_span_ms = 0;
+  _poll = DISCIPLINE_MIN_POLL;
+  _disciplined = true;
+}
+
+/**
+ * Drift over the whole measurement, noise on single samples averages out
+ * as it grows
+*/
+static void update_drift(unsigned long at, int64_t ms)
+{
+  int64_t span = (int64_t)(at - _drift_base_millis);
+  if (span < DISCIPLINE_DRIFT_MIN_SPAN * 1000LL)
+    return;
+  int64_t ppb = ((ms - _drift_base_ms) - span) * 1000000000LL / span;
+  if (abs64(ppb) > DISCIPLINE_MAX_PPM * 1000LL)
+    return;
+  _drift_ppb = ppb;
+  _drift_known = true;
+  // Start a new measurement before millis() could wrap, the current
+  // estimate holds until it is long enough
+  if (span >= DISCIPLINE_DRIFT_MAX_SPAN * 1000LL)
+  {
+    _drift_base_millis = at;
+    _drift_base_ms = ms;
+  }
+}
+
+bool discipline_update()
+{
+  if (_sample_count == 0)
+    return false;
+
+  // The shortest round trip is the least skewed by queuing
+  int best = 0;
+  for (int i = 1; i < _sample_count; i++)
+    if (sample_delay(_samples[i]) < sample_delay(_samples[best]))
+      best = i;
+  const t_ntp_sample &sample = _samples[best];
+  int64_t delay = sample_delay(sample);
+  _sample_count = 0;
+
+  // The reply spent half the round trip on the way back
+  unsigned long at = sample.received;
+  int64_t ms = sample.server_tx + delay / 2;
+  if (!_disciplined)
+  {
+    restart(at, ms);
+    Serial.printf("NTP: clock set, delay %ld ms\n", (long)delay);
+    return true;
+  }
+
+  int64_t offset = ms - discipline_time_ms(at);
+  if (abs64(offset) > DISCIPLINE_STEP_MS)
+  {
+    restart(at, ms);
+    Serial.printf("NTP: clock stepped by %ld ms\n", (long)offset);
+    return true;
+  }
+
+  // The clock carries on from where it is now, with the old drift and any
+  // slew still running folded in, so it never jumps
+  unsigned long now = millis();
+  int64_t current = discipline_time_ms(now);
+  update_drift(at, ms);
+  _base_millis = now;
+  _base_ms = current;
+  if (abs64(offset) > DISCIPLINE_LOOSE_MS)
+    _poll = _poll / 2 > DISCIPLINE_MIN_POLL ? _poll / 2 : DISCIPLINE_MIN_POLL;
+  else if (abs64(offset) < DISCIPLINE_TIGHT_MS && _drift_known)
+    _poll = _poll * 2 < DISCIPLINE_MAX_POLL ? _poll * 2 : DISCIPLINE_MAX_POLL;
+  else if (abs64(offset) < DISCIPLINE_TIGHT_MS && _poll * 2 <= DISCIPLINE_DRIFT_MIN_SPAN)
+    _poll *= 2; // Drift is not known yet, polls stay short enough to measure it
+  // Worked in at a steady rate until the next sync is due
+  _slew_ms = offset;
+  _slew_span_ms = _poll * 1000LL;
+  Serial.printf("NTP: offset %ld ms, delay %ld ms, drift %ld ppb, next sync in %lu s\n",
+    (long)offset, (long)delay, (long)_drift_ppb, (unsigned long)_poll);
+  return true;
+}
+
+bool discipline_synced()
+{
+  return _disciplined;
+}
+
+int64_t discipline_time_ms(unsigned long at)
+{
+  if (!_disciplined)
+    return 0;
+  // Signed, moments just before the last sync work too
+  int64_t elapsed = (long)(at - _base_millis);
+  int64_t slewed = 0;
+  if (elapsed >= _slew_span_ms)
+    slewed = _slew_ms;
+  else if (elapsed > 0)
+    slewed = _slew_ms * elapsed / _slew_span_ms;
+  return _base_ms + elapsed + elapsed * _drift_ppb / 1000000000LL + slewed;
+}
+
+unsigned long discipline_poll_interval()
+{
+  return _poll * 1000UL;
+}
+
+int32_t discipline_drift_ppb()
+{
+  return _drift_ppb;
+}
@@ -1,4 +1,7 @@
 #include "clock_manager.h"
+#include "motion_planner.h"
+#include "bus_manager.h"
+#include "crc16.h"
 
 int _speed = 200;
 int _acceleration = 100;
@@ -7,9 +10,20 @@ int _direction = MIN_DISTANCE;
 // Changes when the clock state changes
 uint32_t _counter = 1;
 
-const t_digit _digits[10] = {digit_0, digit_1, digit_2, digit_3, digit_4, digit_5, digit_6, digit_7, digit_8, digit_9};
+// Boards on the bus, set by discover_boards()
+int _board_count = DEFAULT_BOARDS;
 // Last sended clock state
-half_digit _last_state[8] = {0};
+half_digit _last_state[MAX_BOARDS] = {0};
+// False until the board received a full state, deltas are relative to it
+bool _board_synced[MAX_BOARDS] = {false};
+// Sequence number of the last frame prepared for each board
+uint8_t _tx_seq[MAX_BOARDS] = {0};
+// Epoch of the frames being staged, boards apply them together on commit
+uint16_t _epoch = 0;
+bool _staged_any = false;
+// Result of the last status poll, cleared by every frame sent
+bool _boards_idle = false;
+unsigned long _last_poll = 0;
 
 int get_speed()
 {
@@ -42,28 +56,411 @@ void set_direction(int value)
 }
 
 
+// True if the mode moves the hand even when the target angle is unchanged
+static bool moves_in_place(uint8_t mode)
+{
+  return mode == ADJUST_HAND || (mode <= MAX_DISTANCE3 && mode % 3 != 0);
+}
+
+// Bitmask of the fields that differ between two clock states
+static uint16_t diff_clock_fields(const t_clock &from, const t_clock &to)
+{
+  uint16_t mask = 0;
+  for (int f = 0; f < CLOCK_FIELDS_COUNT; f++)
+    if (memcmp((const uint8_t *)&from + clock_fields[f].offset,
+               (const uint8_t *)&to + clock_fields[f].offset,
+               clock_fields[f].size) != 0)
+      mask |= 1 << f;
+  return mask;
+}
+
+/**
+ * Encodes the delta payload from last to next into buffer. Clocks that would not
+ * move are left out and keep their last sent state in next.
+ * @return payload length, 0 if nothing has to be sent
+ */
+static size_t encode_delta_payload(const t_half_digit &last, t_half_digit &next, bool full, uint8_t *buffer)
+{
+  size_t len = 0;
+  uint8_t &clock_mask = buffer[len++];
+  clock_mask = 0;
+
+  for (int i = 0; i < 3; i++)
+  {
+    uint16_t field_mask = full ? CLOCK_FIELDS_ALL : diff_clock_fields(last.clocks[i], next.clocks[i]);
+    bool counter_changed = next.change_counter[i] != last.change_counter[i];
+    if (!full && (!counter_changed ||
+                  (field_mask == 0 && !moves_in_place(next.clocks[i].mode_h) && !moves_in_place(next.clocks[i].mode_m))))
+    {
+      // Nothing the board would act on, it keeps the state it already has
+      next.clocks[i] = last.clocks[i];
+      next.change_counter[i] = last.change_counter[i];
+      continue;
+    }
+
+    clock_mask |= 1 << i;
+    memcpy(buffer + len, &field_mask, sizeof(field_mask));
+    len += sizeof(field_mask);
+    memcpy(buffer + len, &next.change_counter[i], sizeof(next.change_counter[i]));
+    len += sizeof(next.change_counter[i]);
+    for (int f = 0; f < CLOCK_FIELDS_COUNT; f++)
+    {
+      if (!(field_mask & (1 << f)))
+        continue;
+      memcpy(buffer + len, (const uint8_t *)&next.clocks[i] + clock_fields[f].offset, clock_fields[f].size);
+      len += clock_fields[f].size;
+    }
+  }
+  return clock_mask ? len : 0;
+}
+
+/**
+ * Writes the frame header, commits get sequence number 0
+*/
+static void begin_frame(t_bus_frame *frame, uint8_t address, uint8_t type)
+{
+  frame->address = address;
+  frame->data[0] = I2C_PROTOCOL_VERSION;
+  frame->data[1] = type;
+  frame->data[3] = address >= 1 && address <= MAX_BOARDS ? ++_tx_seq[address - 1] : 0;
+}
+
+/**
+ * Fills in the frame length and appends the CRC
+ * @param payload_len   bytes written after the header
+*/
+static void seal_frame(t_bus_frame *frame, size_t payload_len)
+{
+  size_t len = I2C_FRAME_HEADER_SIZE + payload_len;
+  uint16_t crc;
+  frame->data[2] = len + I2C_FRAME_CRC_SIZE;
+  crc = crc16(frame->data, len);
+  memcpy(frame->data + len, &crc, sizeof(crc));
+  frame->len = len + I2C_FRAME_CRC_SIZE;
+}
+
+bool prepare_half_digit(int index, t_half_digit half_digit, bool staged, t_bus_frame *frame)
+{
+  if (index < 0 || index >= _board_count)
+    return false;
+
+  size_t len = 0;
+  uint8_t *payload = frame->data + I2C_FRAME_HEADER_SIZE;
+  if (staged)
+  {
+    memcpy(payload, &_epoch, sizeof(_epoch));
+    len += sizeof(_epoch);
+  }
+
+  size_t delta_len = encode_delta_payload(_last_state[index], half_digit, !_board_synced[index], payload + len);
+  _last_state[index] = half_digit;
+  if (delta_len == 0)
+    return false;
+
+  begin_frame(frame, index + 1, staged ? FRAME_STAGE : FRAME_DELTA);
+  seal_frame(frame, len + delta_len);
+  _board_synced[index] = true;
+  _staged_any |= staged;
+  return true;
+}
+
+bool prepare_commit(t_bus_frame *frame)
+{
+  if (!_staged_any)
+    return false;
+
+  begin_frame(frame, I2C_GENERAL_CALL, FRAME_COMMIT);
+  memcpy(frame->data + I2C_FRAME_HEADER_SIZE, &_epoch, sizeof(_epoch));
+  seal_frame(frame, sizeof(_epoch));
+  _staged_any = false;
+  _epoch++;
+  return true;
+}
+
+/**
+ * Reads the sequence number of the last frame a board accepted
+ * @return true if it is the one of frame
+*/
+static bool frame_accepted(const t_bus_frame *frame)
+{
+  uint8_t ack[2];
+  return bus_read(frame->address, ack, sizeof(ack)) &&
+    ack[0] == I2C_PROTOCOL_VERSION && ack[1] == frame->data[3];
+}
+
+bool send_frame(const t_bus_frame *frame)
+{
+  _boards_idle = false;
+  uint8_t type = frame->data[1];
+
+  if (type == FRAME_COMMIT)
+  {
+    // Commits have no single board to ask, a second copy covers a board
+    // that dropped the first one, committing twice does nothing
+    bool sent = bus_write(frame->address, frame->data, frame->len);
+    if (bus_write(frame->address, frame->data, frame->len) || sent)
+      return true;
+  }
+  else
+  {
+    // A board drops a corrupted frame, its status tells if the frame made
+    // it. Selects are not checked, the check would use up the read they
+    // select
+    bool check = type == FRAME_DELTA || type == FRAME_STAGE;
+    for (int attempt = 0; attempt <= FRAME_RETRANSMITS; attempt++)
+    {
+      if (attempt > 0)
+        bus_record_retransmit(frame->address);
+      if (!bus_write(frame->address, frame->data, frame->len))
+        break;
+      if (!check || frame_accepted(frame))
+        return true;
+    }
+  }
+
+  // Only the boards that missed the frame get a complete state next
+  if (frame->address == I2C_GENERAL_CALL)
+    resync_boards();
+  else if (frame->address <= MAX_BOARDS)
+    _board_synced[frame->address - 1] = false;
+  Serial.printf("Frame to 0x%02x lost\n", frame->address);
+  return false;
+}
+
+bool read_board_status(int index, t_board_status *status)
+{
+  return bus_read(index + 1, (uint8_t *)status, sizeof(t_board_status)) &&
+    status->version == I2C_PROTOCOL_VERSION;
+}
+
+bool read_board_stats(int index, t_board_stats *stats)
+{
+  t_bus_frame frame;
+  for (int attempt = 0; attempt <= FRAME_RETRANSMITS; attempt++)
+  {
+    if (attempt > 0)
+      bus_record_retransmit(index + 1);
+    begin_frame(&frame, index + 1, FRAME_SELECT);
+    frame.data[I2C_FRAME_HEADER_SIZE] = READ_STATS;
+    seal_frame(&frame, 1);
+    if (!send_frame(&frame))
+      return false;
+    // The sequence number tells the stats were selected, a board that
+    // dropped the select answers with its shorter status
+    if (bus_read(index + 1, (uint8_t *)stats, sizeof(t_board_stats)) &&
+        stats->version == I2C_PROTOCOL_VERSION && stats->rx_seq == frame.data[3])
+      return true;
+  }
+  return false;
+}
+
+bool boards_idle()
+{
+  if (_boards_idle || millis() - _last_poll < BOARD_POLL_INTERVAL)
+    return _boards_idle;
+  _last_poll = millis();
+
+  // The first busy board ends the pass, no need to read the others.
+  // Missing boards are left out, they would hold every wait to the end
+  for (int i = 0; i < _board_count; i++)
+  {
+    t_board_status status;
+    if (!bus_health(i + 1).present)
+      continue;
+    if (!read_board_status(i, &status) || status.running || status.pending)
+      return false;
+  }
+  _boards_idle = true;
+  return true;
+}
+
+int discover_boards(int count)
+{
+  if (count <= 0)
+  {
+    // The highest address answering sets the width, a dead board in the
+    // middle keeps its place
+    for (int i = 0; i < MAX_BOARDS; i++)
+      if (bus_probe(i + 1))
+        count = i + 1;
+    if (count <= 0)
+      count = DEFAULT_BOARDS;
+  }
+  else
+  {
+    // The width is fixed, the probes still tell which boards are present
+    for (int i = 0; i < count && i < MAX_BOARDS; i++)
+      bus_probe(i + 1);
+  }
+  _board_count = count < MAX_BOARDS ? count : MAX_BOARDS;
+  resync_boards();
+  return _board_count;
+}
+
+int get_board_count()
+{
+  return _board_count;
+}
+
+/**
+ * Sends a test pattern to a board and reads it back
+ * @return true if it came back whole without a single retry
+*/
+static bool echo_board(int index, uint8_t round)
+{
+  t_bus_frame frame;
+  t_board_echo echo;
+  uint8_t *pattern = frame.data + I2C_FRAME_HEADER_SIZE;
+  // Alternating bits with a moving start, the hardest on slow edges
+  for (int i = 0; i < I2C_ECHO_SIZE; i++)
+    pattern[i] = (i + round) % 2 ? 0x55 ^ (i * 0x11) : 0xAA ^ round;
+  begin_frame(&frame, index + 1, FRAME_ECHO);
+  seal_frame(&frame, I2C_ECHO_SIZE);
+
+  uint32_t retries = bus_health(index + 1).retries;
+  return bus_write(frame.address, frame.data, frame.len) &&
+    bus_read(frame.address, (uint8_t *)&echo, sizeof(echo)) &&
+    bus_health(index + 1).retries == retries &&
+    echo.version == I2C_PROTOCOL_VERSION && echo.rx_seq == frame.data[3] &&
+    echo.crc == crc16((const uint8_t *)&echo, offsetof(t_board_echo, crc)) &&
+    memcmp(echo.pattern, pattern, I2C_ECHO_SIZE) == 0;
+}
+
+/**
+ * Runs the echo test on every board present at a clock
+ * @return false if a board failed, or none is present
+*/
+static bool bus_clock_stable(uint32_t frequency)
+{
+  int tested = 0;
+  bus_set_clock(frequency);
+  for (int i = 0; i < _board_count; i++)
+  {
+    if (!bus_health(i + 1).present)
+      continue;
+    for (int round = 0; round < BUS_ECHO_ROUNDS; round++)
+      if (!echo_board(i, round))
+        return false;
+    tested++;
+  }
+  return tested > 0;
+}
+
+uint32_t select_bus_clock(uint32_t limit)
+{
+  uint32_t selected = BUS_CLOCK_SLOWEST;
+  for (uint32_t frequency = bus_step_clock(selected, true);
+       frequency && (limit == 0 || frequency <= limit);
+       frequency = bus_step_clock(frequency, true))
+  {
+    if (!bus_clock_stable(frequency))
+      break;
+    selected = frequency;
+  }
+  bus_set_clock(selected);
+  return selected;
+}
+
+void check_boards()
+{
+  // A board that answers again may have restarted and lost its state
+  uint16_t back = bus_rescan();
+  for (int i = 0; i < _board_count; i++)
+  {
+    if (back & (1 << i))
+    {
+      _board_synced[i] = false;
+      Serial.printf("Board %d is back\n", i);
+    }
+  }
+
+  // A clock that passed the echo test can still fail under load or once
+  // the wiring warms up, the slower one is kept across restarts
+  uint32_t slower = bus_step_clock(bus_get_clock(), false);
+  if (slower && bus_errors_rising())
+  {
+    Serial.printf("Bus errors rising, clock down to %lu Hz\n", (unsigned long)slower);
+    bus_set_clock(slower);
+    set_bus_clock(slower);
+  }
+}
+
+void resync_boards()
+{
+  for (int i = 0; i < MAX_BOARDS; i++)
+    _board_synced[i] = false;
+  _staged_any = false;
+  _epoch++;
+}
+
+t_half_digit get_last_half_digit(int index)
+{
+  return _last_state[index];
+}
+
+bool is_board_synced(int index)
+{
+  return _board_synced[index];
+}
+
+void plan_half_digits(int first, t_half_digit *half_digits, int count, const bool *include)
+{
+  // Boards that lost track of their state could be anywhere, they keep their speeds
+  bool planned[MAX_BOARDS];
+  for (int i = 0; i < count; i++)
+    planned[i] = _board_synced[first + i] && (!include || include[i]);
+  plan_synchronized(_last_state + first, half_digits, count, planned);
+}
+
+uint32_t take_change_counter()
+{
+  return _counter++;
+}
+
 void send_half_digit(int index, t_half_digit half_digit)
 {
-  Wire.beginTransmission(index + 1);
-  I2C_writeAnything(half_digit);
-  Wire.endTransmission();
+  t_bus_frame frame;
+  if (prepare_half_digit(index, half_digit, false, &frame))
+    send_frame(&frame);
+}
+
+void stage_half_digit(int index, t_half_digit half_digit)
+{
+  t_bus_frame frame;
+  if (prepare_half_digit(index, half_digit, true, &frame))
+    send_frame(&frame);
+}
+
+void commit_staged()
+{
+  t_bus_frame frame;
+  if (prepare_commit(&frame))
+    send_frame(&frame);
 }
 
-// 0 <= index < 4
-void send_digit(int index, t_digit digit)
+// 0 <= index < MAX_DIGITS
+void send_digit(int index, const t_digit &digit)
 {
-    t_half_digit l = get_full_half_digit(digit.halfs[0]);
-    t_half_digit r = get_full_half_digit(digit.halfs[1]);
-    send_half_digit(index*2, l);
-    send_half_digit(index*2 + 1, r);
-    _last_state[index*2] = l;
-    _last_state[index*2 + 1] = r;
+  // The last digit of an odd grid only has its left half
+  int count = _board_count - index*2 < 2 ? _board_count - index*2 : 2;
+  if (count <= 0)
+    return;
+  t_half_digit halfs[2] = {get_full_half_digit(digit.halfs[0]), get_full_half_digit(digit.halfs[1])};
+  plan_half_digits(index*2, halfs, count);
+  for (int i = 0; i < count; i++)
+    stage_half_digit(index*2 + i, halfs[i]);
+  commit_staged();
 }
 
-void send_clock(t_full_clock full_clock)
+void send_clock(const t_full_clock &full_clock)
 {
-  for (int i = 0; i < 4; i++)
-    send_digit(i, full_clock.digit[i]);
+  t_half_digit boards[MAX_BOARDS];
+  for (int i = 0; i < _board_count; i++)
+    boards[i] = get_full_half_digit(full_clock.digit[i / 2].halfs[i % 2]);
+  plan_half_digits(0, boards, _board_count);
+  for (int i = 0; i < _board_count; i++)
+    stage_half_digit(i, boards[i]);
+  commit_staged();
 }
 
 t_half_digit get_full_half_digit(t_half_digitl lite_digit)
@@ -86,25 +483,24 @@ t_half_digit get_full_half_digit(t_half_digitl lite_digit)
   return tmp;
 }
 
-void set_clock(t_full_clock clock_state)
+void set_clock(const t_full_clock &clock_state)
 {
   send_clock(clock_state);
   _counter++;
 }
 
-// 0 <= index < 4
-void set_digit(int index, t_digit digit)
+// 0 <= index < MAX_DIGITS
+void set_digit(int index, const t_digit &digit)
 {
   send_digit(index, digit);
   _counter++;
 }
 
-// 0 <= index < 8
+// 0 <= index < _board_count
 void set_half_digit(int index, t_half_digitl half)
 {
     t_half_digit hd = get_full_half_digit(half);
     send_half_digit(index, hd);
-    _last_state[index] = hd;
     _counter++;
 }
 
@@ -117,17 +513,25 @@ void set_clock_time(int h, int m)
 
 t_full_clock get_clock_state_from_time(int h, int m)
 {
-  int d0 = h / 10;
-  int d1 = h - d0 * 10;  
-  int d2 = m / 10;
-  int d3 = m - d2 * 10;
-  Serial.printf("Set time: %d:%d\n", h, m);
-  t_full_clock clock_state = {_digits[d0], _digits[d1], _digits[d2], _digits[d3]};
+  t_full_clock clock_state;
+  for (int i = 0; i < MAX_DIGITS; i++)
+    clock_state.digit[i] = font[get_time_glyph(h, m, i)];
   return clock_state;
 }
 
+uint8_t get_time_glyph(int h, int m, int index)
+{
+  // The time is centered, wider grids show blanks around it
+  int digits = _board_count / 2;
+  int first = digits > 4 ? (digits - 4) / 2 : 0;
+  index -= first;
+  return index >= 0 && index < 4 ? glyph_from_time(h, m, index) : GLYPH_BLANK;
+}
+
 void adjust_hands(int clock_index, int h_amount, int m_amount)
 {
+  if (clock_index < 0 || clock_index >= _board_count * 3)
+    return;
   t_half_digit tmp = _last_state[clock_index/3];
   tmp.clocks[clock_index % 3].adjust_h = ((signed char) h_amount);
   tmp.clocks[clock_index % 3].adjust_m = ((signed char) m_amount);
@@ -15,48 +15,27 @@
 #include "captive_portal.h"
 #include "mqtt_handler.h"
 #include "update_handler.h"
+#include "choreography.h"
 
-int last_hour = -1;
-int last_minute = -1;
-bool is_stopped = false;
 const unsigned long SCHEDULED_RESTART_DELAY_MS = 3000;
 static int last_restart_day = -1;
 
-/**
- * Sets clock to the current time
-*/
-void set_time();
-
-/**
- * Sets clock time using lazy animation
-*/
-void set_lazy();
-
-/**
- * Sets clock time using fun animation
-*/
-void set_fun();
-
-/**
- * Sets clock time using waves animation
-*/
-void set_waves();
-
-/**
- * Sets clock to stop state
-*/
-void stop();
+#ifdef CHOREOGRAPHY_TASK
+#define NETWORK_CORE 0
+#define NETWORK_TASK_PRIORITY 1
+#define NETWORK_TASK_STACK 8192
 
 /**
- * Quickly stops the clock with fixed speed for OTA
+ * Network services, runs on the core the WiFi stack lives on
 */
-void shutdown();
+static void network_task(void *param);
+#endif
 
 /**
- * Custom delay to update web clients
- * @param value   time in milliseconds
+ * Web server, MQTT, WiFi watchdogs and time keeping, everything that can
+ * block on the network. Never touches the I2C bus.
 */
-void _delay(int value);
+static void network_loop();
 
 void setup() {
   Serial.begin(115200);
@@ -70,6 +49,8 @@ void setup() {
   begin_config();
 
   Wire.begin(I2C_SDA, I2C_SCL);
+  Serial.printf("Boards: %d\n", discover_boards(get_boards()));
+  Serial.printf("Bus clock: %lu Hz\n", (unsigned long)select_bus_clock(get_bus_clock()));
 
   if(get_connection_mode() == HOTSPOT)
     wifi_create_AP("ClockClock 24", get_hostname());
@@ -82,11 +63,9 @@ void setup() {
 
   if(get_active_connection_mode() == EXT_CONN)
   {
-    // Initialize NTP
+    // Initialize NTP, the first sync completes in update_NTP()
+    tz_set(get_timezone());
     begin_NTP();
-    setSyncProvider(get_NTP_time);
-    // Sync every 30 minutes
-    setSyncInterval(60 * 30);
     
     // Initialize MQTT (only in external connection mode)
     mqtt_init();
@@ -94,9 +73,36 @@ void setup() {
 
   // Starts web server
   server_start();
+
+  choreography_begin();
+#ifdef CHOREOGRAPHY_TASK
+  xTaskCreatePinnedToCore(network_task, "network", NETWORK_TASK_STACK,
+    NULL, NETWORK_TASK_PRIORITY, NULL, NETWORK_CORE);
+#endif
 }
 
 void loop() {
+#ifdef CHOREOGRAPHY_TASK
+  // Everything runs in the pinned tasks
+  vTaskDelete(NULL);
+#else
+  network_loop();
+  choreography_loop();
+#endif
+}
+
+#ifdef CHOREOGRAPHY_TASK
+static void network_task(void *param)
+{
+  for (;;)
+  {
+    network_loop();
+    vTaskDelay(1);
+  }
+}
+#endif
+
+static void network_loop() {
   // Daily restart at configured hour
   if (!update_in_progress() && get_daily_restart_enabled())
   {
@@ -150,114 +156,23 @@ void loop() {
       browser_time.year);
   }
 
-  if(get_active_connection_mode() == EXT_CONN && get_timezone() != get_ntp_timezone())
+  if(get_active_connection_mode() == EXT_CONN)
   {
-    set_ntp_timezone(get_timezone());
-    setSyncProvider(get_NTP_time);
+    if(strcmp(get_timezone(), tz_get()) != 0)
+      tz_set(get_timezone());
+    update_NTP();
   }
 
-  get_clock_mode() != OFF ? set_time() : stop();
+  // Until the first sync the time is 1970, not worth showing
+  if(get_active_connection_mode() != EXT_CONN || timeStatus() != timeNotSet)
+    choreography_set_time(now());
 
   handle_webclient();
+
+  // Settings changed in a burst go out in one flash write
+  update_config();
   
   // Handle MQTT
   if(get_active_connection_mode() == EXT_CONN)
     mqtt_handle();
 }
-
-void set_time()
-{
-  int day_week = (weekday() + 5) % 7;
-  if(get_sleep_time(day_week, hour()))
-    stop();
-  else if(hour() != last_hour || minute() != last_minute)
-  {
-    is_stopped = false;
-    last_hour = hour();
-    last_minute = minute();
-    switch(get_clock_mode())
-    {
-      case LAZY:
-        set_lazy();
-        break;
-      case FUN:
-        set_fun();
-        break;
-      case WAVES:
-        set_waves();
-        break;
-    }
-  }
-}
-
-void set_lazy()
-{
-  set_speed(200 * get_speed_multiplier());
-  set_acceleration(100 * get_speed_multiplier());
-  set_direction(MIN_DISTANCE);
-  set_clock_time(last_hour, last_minute);
-}
-
-void set_fun()
-{
-  set_speed(400 * get_speed_multiplier());
-  set_acceleration(150 * get_speed_multiplier());
-  set_direction(CLOCKWISE2);
-  set_clock_time(last_hour, last_minute);
-}
-
-void set_waves()
-{
-  set_speed(800 * get_speed_multiplier());
-  set_acceleration(150 * get_speed_multiplier());
-  set_direction(MIN_DISTANCE);
-  set_clock(d_IIII);
-  _delay(4000 +(9000 - 4000) / sqrt(get_speed_multiplier()));
-  set_speed(400 * get_speed_multiplier());
-  set_acceleration(100 * get_speed_multiplier());
-  set_direction(CLOCKWISE2);
-  t_full_clock clock = get_clock_state_from_time(last_hour, last_minute);
-  for (int i = 0; i <8; i++)
-  {
-    set_half_digit(i, clock.digit[i/2].halfs[i%2]);
-    delay(200 + (400 - 200) / sqrt(get_speed_multiplier()));
-  }
-}
-
-void stop()
-{
-  if(!is_stopped)
-  {
-    is_stopped = true;
-    last_hour = -1;
-    last_minute = -1;
-    set_direction(MIN_DISTANCE);
-    set_speed(200 * get_speed_multiplier());
-    set_acceleration(100 * get_speed_multiplier());
-    set_clock(d_stop);
-  }
-}
-
-void shutdown()
-{
-  set_clock_mode_temp(OFF);
-  if(!is_stopped)
-  {
-    is_stopped = true;
-    last_hour = -1;
-    last_minute = -1;
-    set_direction(MIN_DISTANCE);
-    set_speed(200 * 100);
-    set_acceleration(100 * 100);
-    set_clock(d_stop);
-  }
-}
-
-void _delay(int value)
-{
-  for (int i = 0; i <value/100; i++)
-  {
-    handle_webclient();
-    delay(value/100);
-  }
-}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "motion_planner.h"
+
+static uint64_t isqrt64(uint64_t value)
+{
+  uint64_t result = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+  while (bit > value)
+    bit >>= 2;
+  while (bit)
+  {
+    if (value >= result + bit)
+    {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    }
+    else
+      result >>= 1;
+    bit >>= 2;
+  }
+  return result;
+}
+
+static int angle_clockwise(int from, int to)
+{
+  int delta = (to - from) % 360;
+  return delta <= 0 ? -delta : 360 - delta;
+}
+
+static int angle_counterclockwise(int from, int to)
+{
+  int delta = (to - from) % 360;
+  return delta < 0 ? 360 + delta : delta;
+}
+
+uint32_t planner_move_steps(uint16_t from, uint16_t to, uint8_t mode)
+{
+  if (mode > MAX_DISTANCE3)
+    return 0;
+
+  int cw = angle_clockwise(from % 360, to % 360);
+  int ccw = angle_counterclockwise(from % 360, to % 360);
+  int delta;
+  if (mode <= CLOCKWISE3)
+    delta = cw;
+  else if (mode <= COUNTERCLOCKWISE3)
+    delta = ccw;
+  else if (mode <= MIN_DISTANCE3)
+    delta = cw < ccw ? cw : ccw;
+  else
+    delta = cw > ccw ? cw : ccw;
+
+  // Every mode has a variant with one and two extra turns
+  return delta * HAND_STEPS_PER_TURN / 360 + HAND_STEPS_PER_TURN * (mode % 3);
+}
+
+uint64_t planner_move_duration(uint32_t steps, uint32_t speed, uint32_t accel, bool scurve)
+{
+  if (steps == 0)
+    return 0;
+  if (speed == 0)
+    speed = 1;
+  if (accel == 0)
+    accel = 1;
+
+  // Steps spent reaching max speed and braking from it, S-curve ramps
+  // keep the same peak acceleration and take 1.5 times longer
+  uint64_t ramps = (uint64_t)speed * speed / accel;
+  uint64_t ramps_us = (uint64_t)speed * 1000000 / accel;
+  if (scurve)
+  {
+    ramps = ramps * 3 / 2;
+    ramps_us = ramps_us * 3 / 2;
+  }
+  uint64_t duration;
+  if (steps >= ramps)
+    duration = (uint64_t)steps * 1000000 / speed + ramps_us;
+  else // Max speed is never reached: accelerate half way, brake the other half
+    duration = isqrt64((uint64_t)steps * (scurve ? 6 : 4) * 1000000000000ull / accel);
+  if (scurve)
+    return duration;
+
+  // The slaves pulse the first step right away and their ramps (Austin's
+  // approximation) run slightly ahead, each ramp ends about sqrt(2 / a) early
+  uint64_t early = 2 * isqrt64(2000000000000ull / accel);
+  return duration > early ? duration - early : duration / 2;
+}
+
+// Rounded up, a short move rounded down could end after the slowest one
+static uint16_t scale_rate(uint16_t value, uint32_t steps, uint32_t longest)
+{
+  return ((uint32_t)value * steps + longest - 1) / longest;
+}
+
+void plan_synchronized(const t_half_digit *from, t_half_digit *to, int count, const bool *include)
+{
+  // Slowest move, its profile is shared by every hand
+  uint64_t slowest = 0;
+  uint32_t longest = 0;
+  uint16_t speed = 0;
+  uint16_t accel = 0;
+
+  for (int b = 0; b < count; b++)
+  {
+    if (include && !include[b])
+      continue;
+    for (int c = 0; c < 3; c++)
+    {
+      const t_clock &last = from[b].clocks[c];
+      const t_clock &next = to[b].clocks[c];
+      uint32_t steps_h = planner_move_steps(last.angle_h, next.angle_h, next.mode_h);
+      uint32_t steps_m = planner_move_steps(last.angle_m, next.angle_m, next.mode_m);
+      bool scurve = next.flags & CLOCK_FLAG_SCURVE;
+      uint64_t duration_h = planner_move_duration(steps_h, next.speed_h, next.accel_h, scurve);
+      uint64_t duration_m = planner_move_duration(steps_m, next.speed_m, next.accel_m, scurve);
+      if (duration_h > slowest)
+      {
+        slowest = duration_h;
+        longest = steps_h;
+        speed = next.speed_h;
+        accel = next.accel_h;
+      }
+      if (duration_m > slowest)
+      {
+        slowest = duration_m;
+        longest = steps_m;
+        speed = next.speed_m;
+        accel = next.accel_m;
+      }
+    }
+  }
+  if (longest == 0)
+    return;
+
+  // The same profile scaled by distance takes the same time
+  for (int b = 0; b < count; b++)
+  {
+    if (include && !include[b])
+      continue;
+    for (int c = 0; c < 3; c++)
+    {
+      const t_clock &last = from[b].clocks[c];
+      t_clock &next = to[b].clocks[c];
+      uint32_t steps_h = planner_move_steps(last.angle_h, next.angle_h, next.mode_h);
+      uint32_t steps_m = planner_move_steps(last.angle_m, next.angle_m, next.mode_m);
+      if (steps_h > 0)
+      {
+        next.speed_h = scale_rate(speed, steps_h, longest);
+        next.accel_h = scale_rate(accel, steps_h, longest);
+      }
+      if (steps_m > 0)
+      {
+        next.speed_m = scale_rate(speed, steps_m, longest);
+        next.accel_m = scale_rate(accel, steps_m, longest);
+      }
+    }
+  }
+}
@@ -1,5 +1,7 @@
 #include "mqtt_handler.h"
 #include "clock_config.h"
+#include "clock_manager.h"
+#include "bus_manager.h"
 #include <WiFi.h>
 #include <PubSubClient.h>
 
@@ -11,6 +13,7 @@ PubSubClient _mqtt_client(_mqtt_wifi_client);
 String _mqtt_base_topic;
 String _mqtt_state_topic;
 String _mqtt_command_topic;
+String _mqtt_bus_topic;
 
 // State tracking
 unsigned long _last_reconnect_attempt = 0;
@@ -38,6 +41,7 @@ void mqtt_init()
     _mqtt_base_topic = "clockclock24/" + hostname;
     _mqtt_state_topic = _mqtt_base_topic + "/state";
     _mqtt_command_topic = _mqtt_base_topic + "/set";
+    _mqtt_bus_topic = _mqtt_base_topic + "/bus/";
 
     // Configure MQTT client
     _mqtt_client.setServer(get_mqtt_broker(), get_mqtt_port());
@@ -124,6 +128,7 @@ void mqtt_handle()
         if (now - _last_state_publish > STATE_PUBLISH_INTERVAL)
         {
             mqtt_publish_state();
+            mqtt_publish_bus_health();
             _last_state_publish = now;
         }
     }
@@ -208,6 +213,23 @@ void mqtt_publish_state()
     _mqtt_client.publish(_mqtt_state_topic.c_str(), state_payload.c_str(), false);
 }
 
+void mqtt_publish_bus_health()
+{
+    if (!_mqtt_client.connected())
+    {
+        return;
+    }
+
+    // One topic per board, a payload per board stays small
+    char payload[BUS_HEALTH_JSON_SIZE];
+    for (int i = 0; i < get_board_count(); i++)
+    {
+        bus_health_json(payload, sizeof(payload), i + 1);
+        String topic = _mqtt_bus_topic + String(i + 1);
+        _mqtt_client.publish(topic.c_str(), payload, false);
+    }
+}
+
 void mqtt_publish_discovery()
 {
     if (!_mqtt_client.connected())
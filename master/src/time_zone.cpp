@@ -0,0 +1,293 @@
+#include "time_zone.h"
+#include <ctype.h>
+
+#define TZ_SECS_PER_DAY 86400L
+// Longest offset and latest time of a rule, hours (RFC 8536)
+#define TZ_MAX_OFFSET_HOURS 24
+#define TZ_MAX_RULE_HOURS 167
+
+t_time_zone _zone = {0, 0, false, {}, {}};
+char _zone_string[TZ_STRING_SIZE] = TZ_DEFAULT;
+// Offset in force from _valid_from until the next change, empty until
+// the first look up
+int32_t _offset = 0;
+time_t _valid_from = 1;
+time_t _valid_until = 0;
+
+/**
+ * Zone name, 3 letters or more, or anything quoted in <>
+ * @return end of the name, NULL if not valid
+*/
+static const char *parse_name(const char *p)
+{
+  const char *start = p;
+  if (*p == '<')
+  {
+    start = ++p;
+    while (isalnum((unsigned char)*p) || *p == '+' || *p == '-')
+      p++;
+    if (*p != '>' || p - start < 3)
+      return NULL;
+    return p + 1;
+  }
+  while (isalpha((unsigned char)*p))
+    p++;
+  return p - start >= 3 ? p : NULL;
+}
+
+/**
+ * [+-]hh[:mm[:ss]]
+ * @param seconds   set to the signed value
+ * @param max_hours longest value allowed
+ * @return end of the time, NULL if not valid
+*/
+static const char *parse_time(const char *p, int32_t *seconds, int max_hours)
+{
+  int sign = 1;
+  if (*p == '+' || *p == '-')
+    sign = *p++ == '-' ? -1 : 1;
+  if (!isdigit((unsigned char)*p))
+    return NULL;
+  int32_t parts[3] = {0, 0, 0};
+  for (int i = 0; i < 3; i++)
+  {
+    if (i > 0)
+    {
+      if (*p != ':' || !isdigit((unsigned char)p[1]))
+        break;
+      p++;
+    }
+    int digits = 0;
+    while (isdigit((unsigned char)*p) && digits++ < 3)
+      parts[i] = parts[i] * 10 + (*p++ - '0');
+  }
+  if (parts[0] > max_hours || parts[1] > 59 || parts[2] > 59)
+    return NULL;
+  *seconds = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+  return p;
+}
+
+static const char *parse_number(const char *p, int *value, int min, int max)
+{
+  if (!isdigit((unsigned char)*p))
+    return NULL;
+  *value = 0;
+  while (isdigit((unsigned char)*p) && *value <= max)
+    *value = *value * 10 + (*p++ - '0');
+  return *value >= min && *value <= max ? p : NULL;
+}
+
+/**
+ * Jn, n or Mm.w.d, then an optional /time
+ * @return end of the rule, NULL if not valid
+*/
+static const char *parse_rule(const char *p, t_tz_rule *rule)
+{
+  int value;
+  if (*p == 'M')
+  {
+    int week, weekday;
+    if (!(p = parse_number(p + 1, &value, 1, 12)) || *p != '.' ||
+        !(p = parse_number(p + 1, &week, 1, 5)) || *p != '.' ||
+        !(p = parse_number(p + 1, &weekday, 0, 6)))
+      return NULL;
+    rule->type = TZ_RULE_MONTH_WEEK;
+    rule->month = value;
+    rule->week = week;
+    rule->weekday = weekday;
+  }
+  else if (*p == 'J')
+  {
+    if (!(p = parse_number(p + 1, &value, 1, 365)))
+      return NULL;
+    rule->type = TZ_RULE_JULIAN;
+    rule->day = value;
+  }
+  else
+  {
+    if (!(p = parse_number(p, &value, 0, 365)))
+      return NULL;
+    rule->type = TZ_RULE_DAY;
+    rule->day = value;
+  }
+  rule->time = 2 * 3600;
+  if (*p == '/')
+    p = parse_time(p + 1, &rule->time, TZ_MAX_RULE_HOURS);
+  return p;
+}
+
+bool tz_parse(const char *posix, t_time_zone *zone)
+{
+  const char *p = posix;
+  int32_t offset;
+  if (!p || strlen(p) >= TZ_STRING_SIZE)
+    return false;
+  // POSIX offsets are west of UTC
+  if (!(p = parse_name(p)) || !(p = parse_time(p, &offset, TZ_MAX_OFFSET_HOURS)))
+    return false;
+  zone->std_offset = -offset;
+  zone->dst_offset = zone->std_offset;
+  zone->has_dst = *p != '\0';
+  if (!zone->has_dst)
+    return true;
+
+  if (!(p = parse_name(p)))
+    return false;
+  zone->dst_offset = zone->std_offset + 3600;
+  if (*p != '\0' && *p != ',')
+  {
+    if (!(p = parse_time(p, &offset, TZ_MAX_OFFSET_HOURS)))
+      return false;
+    zone->dst_offset = -offset;
+  }
+  if (*p == '\0')
+    p = ",M3.2.0,M11.1.0"; // US rules
+  if (*p != ',' || !(p = parse_rule(p + 1, &zone->start)) ||
+      *p != ',' || !(p = parse_rule(p + 1, &zone->end)))
+    return false;
+  return *p == '\0';
+}
+
+static bool is_leap(int64_t year)
+{
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+/**
+ * Days since 1970-01-01 of a date, proleptic Gregorian calendar
+*/
+static int64_t days_from_civil(int64_t year, int month, int day)
+{
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t year_of_era = year - era * 400;
+  int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+static int64_t year_of_days(int64_t days)
+{
+  int64_t year = 1970 + days / 366;
+  while (days_from_civil(year + 1, 1, 1) <= days)
+    year++;
+  while (days_from_civil(year, 1, 1) > days)
+    year--;
+  return year;
+}
+
+/**
+ * Day a rule falls on in a year
+ * @return days since 1970-01-01
+*/
+static int64_t rule_day(const t_tz_rule &rule, int64_t year)
+{
+  int64_t first = days_from_civil(year, 1, 1);
+  switch (rule.type)
+  {
+    case TZ_RULE_JULIAN:
+      return first + rule.day - 1 + (is_leap(year) && rule.day >= 60);
+    case TZ_RULE_DAY:
+      return first + rule.day;
+  }
+  first = days_from_civil(year, rule.month, 1);
+  int64_t next = rule.month == 12 ? days_from_civil(year + 1, 1, 1) : days_from_civil(year, rule.month + 1, 1);
+  // 1970-01-01 was a Thursday
+  int first_weekday = ((first + 4) % 7 + 7) % 7;
+  int64_t day = first + (rule.weekday - first_weekday + 7) % 7 + (rule.week - 1) * 7;
+  while (day >= next)
+    day -= 7; // week 5 is the last one, there may be only 4
+  return day;
+}
+
+/**
+ * Finds the offset in force at a time and how long it lasts, from the
+ * changes of the years around it
+*/
+static void look_up(time_t utc)
+{
+  if (!_zone.has_dst)
+  {
+    _offset = _zone.std_offset;
+    _valid_from = utc;
+    _valid_until = utc + 366 * TZ_SECS_PER_DAY;
+    return;
+  }
+
+  // Changes of the years around, and the offset after each
+  int64_t year = year_of_days((int64_t)utc / TZ_SECS_PER_DAY);
+  int64_t changes[6];
+  int32_t offsets[6];
+  int count = 0;
+  for (int64_t y = year - 1; y <= year + 1; y++)
+  {
+    changes[count] = rule_day(_zone.start, y) * TZ_SECS_PER_DAY + _zone.start.time - _zone.std_offset;
+    offsets[count++] = _zone.dst_offset;
+    changes[count] = rule_day(_zone.end, y) * TZ_SECS_PER_DAY + _zone.end.time - _zone.dst_offset;
+    offsets[count++] = _zone.std_offset;
+  }
+  // In time order, the southern hemisphere ends DST first
+  for (int i = 1; i < count; i++)
+  {
+    for (int j = i; j > 0 && changes[j - 1] > changes[j]; j--)
+    {
+      int64_t change = changes[j];
+      changes[j] = changes[j - 1];
+      changes[j - 1] = change;
+      int32_t offset = offsets[j];
+      offsets[j] = offsets[j - 1];
+      offsets[j - 1] = offset;
+    }
+  }
+
+  // The years around always hold a change before and after
+  int last = 0;
+  while (last + 1 < count && changes[last + 1] <= utc)
+    last++;
+  _offset = offsets[last];
+  _valid_from = changes[last];
+  _valid_until = changes[last + 1];
+}
+
+bool tz_set(const char *posix)
+{
+  t_time_zone zone;
+  if (!tz_parse(posix, &zone))
+    return false;
+  _zone = zone;
+  // tz_parse() checked the length
+  strncpy(_zone_string, posix, sizeof(_zone_string) - 1);
+  // Looked up again on the next call
+  _valid_from = 1;
+  _valid_until = 0;
+  return true;
+}
+
+const char *tz_get()
+{
+  return _zone_string;
+}
+
+time_t tz_local(time_t utc)
+{
+  if (utc < _valid_from || utc >= _valid_until)
+    look_up(utc);
+  return utc + _offset;
+}
+
+void tz_fixed(int minutes, char *posix)
+{
+  if (minutes == 0)
+  {
+    strncpy(posix, TZ_DEFAULT, TZ_STRING_SIZE);
+    return;
+  }
+  // The name keeps the usual sign, the POSIX offset is reversed
+  char sign = minutes > 0 ? '+' : '-';
+  int value = minutes > 0 ? minutes : -minutes;
+  if (value % 60)
+    snprintf(posix, TZ_STRING_SIZE, "<%c%02d%02d>%c%d:%02d", sign, value / 60, value % 60,
+      sign == '+' ? '-' : '+', value / 60, value % 60);
+  else
+    snprintf(posix, TZ_STRING_SIZE, "<%c%02d>%c%d", sign, value / 60, sign == '+' ? '-' : '+', value / 60);
+}
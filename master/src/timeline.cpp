@@ -0,0 +1,267 @@
+#include "timeline.h"
+#include "animation_scheduler.h"
+#include "motion_planner.h"
+
+// Frames of the playing timeline, each one stored as address, length, data
+uint8_t _timeline_buffer[TIMELINE_BUFFER_SIZE];
+// Offset of the first frame of each batch in the buffer, plus the end
+uint16_t _batch_offsets[TIMELINE_MAX_KEYFRAMES + 1];
+// Keyframes being encoded, sweeps expanded
+t_timeline_keyframe _keyframes[TIMELINE_MAX_KEYFRAMES];
+
+static unsigned long keyframe_start(const t_timeline_keyframe &keyframe, float scale)
+{
+  return keyframe.start_fixed + (unsigned long)(keyframe.start_scaled * scale);
+}
+
+static uint16_t scale_value(uint16_t value, int multiplier)
+{
+  uint32_t scaled = (uint32_t)value * multiplier;
+  return scaled > 0xFFFF ? 0xFFFF : scaled;
+}
+
+static void apply_keyframe(t_clock &clock, const t_timeline_keyframe &keyframe, const t_clockl &time_clock, int multiplier)
+{
+  clock.angle_h = keyframe.angle_h == TIMELINE_ANGLE_TIME ? time_clock.angle_h : keyframe.angle_h;
+  clock.angle_m = keyframe.angle_m == TIMELINE_ANGLE_TIME ? time_clock.angle_m : keyframe.angle_m;
+  clock.speed_h = clock.speed_m = scale_value(keyframe.speed, multiplier);
+  clock.accel_h = clock.accel_m = scale_value(keyframe.accel, multiplier);
+  clock.mode_h = clock.mode_m = keyframe.mode & ~(TIMELINE_WAIT | TIMELINE_SCURVE);
+  clock.adjust_h = clock.adjust_m = 0;
+  clock.flags = keyframe.mode & TIMELINE_SCURVE ? CLOCK_FLAG_SCURVE : 0;
+}
+
+/**
+ * Appends a frame to the buffer
+ * @return false if it does not fit
+*/
+static bool store_frame(const t_bus_frame &frame, uint16_t &pos)
+{
+  if (pos + 2 + frame.len > TIMELINE_BUFFER_SIZE)
+    return false;
+  _timeline_buffer[pos++] = frame.address;
+  _timeline_buffer[pos++] = frame.len;
+  memcpy(_timeline_buffer + pos, frame.data, frame.len);
+  pos += frame.len;
+  return true;
+}
+
+static void play_batch(int batch)
+{
+  t_bus_frame frame;
+  uint16_t pos = _batch_offsets[batch];
+  while (pos < _batch_offsets[batch + 1])
+  {
+    frame.address = _timeline_buffer[pos++];
+    frame.len = _timeline_buffer[pos++];
+    memcpy(frame.data, _timeline_buffer + pos, frame.len);
+    pos += frame.len;
+    send_frame(&frame);
+  }
+}
+
+/**
+ * Copies keyframes to _keyframes, a sweep becomes one keyframe per board.
+ * Keyframes stay sorted by start, the ones starting together keep their
+ * order.
+ * @return number of keyframes, -1 if they do not fit
+*/
+static int expand_keyframes(const t_timeline_keyframe *keyframes, int count, float scale)
+{
+  int boards = get_board_count();
+  int expanded = 0;
+  for (int i = 0; i < count; i++)
+  {
+    int copies = keyframes[i].target == TIMELINE_SWEEP ? boards : 1;
+    for (int b = 0; b < copies; b++)
+    {
+      if (expanded == TIMELINE_MAX_KEYFRAMES)
+        return -1;
+      t_timeline_keyframe keyframe = keyframes[i];
+      if (keyframe.target == TIMELINE_SWEEP)
+      {
+        keyframe.target = TIMELINE_BOARD(b);
+        keyframe.start_fixed += b * TIMELINE_SWEEP_STEP;
+        keyframe.start_scaled += b * TIMELINE_SWEEP_STEP;
+        if (b > 0)
+          keyframe.mode &= ~TIMELINE_WAIT;
+      }
+      int j = expanded++;
+      for (; j > 0 && keyframe_start(_keyframes[j - 1], scale) > keyframe_start(keyframe, scale); j--)
+        _keyframes[j] = _keyframes[j - 1];
+      _keyframes[j] = keyframe;
+    }
+  }
+  return expanded;
+}
+
+/**
+ * Time a clock takes to run a move, its slower hand
+ * @return us
+*/
+static uint32_t move_duration(const t_clock &from, const t_clock &to)
+{
+  bool scurve = to.flags & CLOCK_FLAG_SCURVE;
+  uint64_t h = planner_move_duration(planner_move_steps(from.angle_h, to.angle_h, to.mode_h), to.speed_h, to.accel_h, scurve);
+  uint64_t m = planner_move_duration(planner_move_steps(from.angle_m, to.angle_m, to.mode_m), to.speed_m, to.accel_m, scurve);
+  return h > m ? h : m;
+}
+
+/**
+ * Turns the expanded keyframes into batches, one animation step each.
+ * Where every hand ends up and when is followed from the states the
+ * boards were last sent, the way the slaves queue keyframes.
+ * @param count     number of keyframes in _keyframes
+ * @param h         hours shown by TIMELINE_ANGLE_TIME
+ * @param m         minutes shown by TIMELINE_ANGLE_TIME
+ * @param steps     filled with the steps, their frames are encoded into
+ *                  the buffer. NULL to only work out the duration
+ * @param duration  set to the time the last hand stops, ms
+ * @return number of batches, -1 if the frames do not fit
+*/
+static int build_batches(int count, int h, int m, t_animation_step *steps, unsigned long &duration)
+{
+  int multiplier = get_speed_multiplier();
+  float scale = 1 / sqrt(multiplier);
+  int board_count = get_board_count();
+  uint8_t time_glyphs[MAX_DIGITS];
+  for (int d = 0; d < MAX_DIGITS; d++)
+    time_glyphs[d] = get_time_glyph(h, m, d);
+
+  t_half_digit states[MAX_BOARDS];
+  bool synced[MAX_BOARDS];
+  for (int b = 0; b < board_count; b++)
+  {
+    states[b] = get_last_half_digit(b);
+    synced[b] = is_board_synced(b);
+  }
+  // When each clock runs out of keyframes and how early the steps run
+  // after waits, us from the start
+  uint32_t ends[MAX_BOARDS * 3] = {0};
+  uint32_t last_end = 0;
+  uint32_t shift = 0;
+
+  int batches = 0;
+  uint16_t pos = 0;
+  bool fits = true;
+
+  for (int i = 0; i < count; )
+  {
+    unsigned long at = keyframe_start(_keyframes[i], scale);
+    uint32_t counter = steps ? take_change_counter() : 0;
+    t_half_digit boards[MAX_BOARDS];
+    bool touched[MAX_BOARDS] = {false};
+    bool moved[MAX_BOARDS * 3] = {false};
+    int touched_count = 0;
+    bool wait = false;
+
+    // Keyframes starting together are sent in the same batch
+    for (; i < count && keyframe_start(_keyframes[i], scale) == at; i++)
+    {
+      wait |= _keyframes[i].mode & TIMELINE_WAIT;
+      for (int c = 0; c < board_count * 3; c++)
+      {
+        uint8_t target = _keyframes[i].target;
+        if (target != TIMELINE_ALL && target != c && target != TIMELINE_BOARD(c / 3))
+          continue;
+        int board = c / 3;
+        if (!touched[board])
+        {
+          boards[board] = states[board];
+          touched[board] = true;
+          touched_count++;
+        }
+        const t_clockl &time = font[time_glyphs[board / 2]].halfs[board % 2].clocks[c % 3];
+        apply_keyframe(boards[board].clocks[c % 3], _keyframes[i], time, multiplier);
+        boards[board].change_counter[c % 3] = counter;
+        moved[c] = true;
+      }
+    }
+
+    // Every hand of the batch arrives at the same time, boards that lost
+    // track of their state could be anywhere, they keep their speeds
+    bool planned[MAX_BOARDS];
+    for (int b = 0; b < board_count; b++)
+      planned[b] = touched[b] && synced[b];
+    plan_synchronized(states, boards, board_count, planned);
+
+    // A waiting batch goes out once the boards are idle, polled every
+    // BOARD_POLL_INTERVAL
+    uint32_t sent = at * 1000 > shift ? at * 1000 - shift : 0;
+    uint32_t idle = last_end + BOARD_POLL_INTERVAL * 1000 / 2;
+    if (wait && idle < sent)
+    {
+      shift += sent - idle;
+      sent = idle;
+    }
+    for (int c = 0; c < board_count * 3; c++)
+    {
+      if (!moved[c])
+        continue;
+      // Boards queue the keyframe behind the one still running
+      uint32_t start = ends[c] > sent ? ends[c] : sent;
+      ends[c] = start + move_duration(states[c / 3].clocks[c % 3], boards[c / 3].clocks[c % 3]);
+      last_end = ends[c] > last_end ? ends[c] : last_end;
+    }
+    for (int b = 0; b < board_count; b++)
+    {
+      if (!touched[b])
+        continue;
+      states[b] = boards[b];
+      synced[b] = true;
+    }
+
+    if (steps)
+    {
+      // A single board does not need to wait for a commit
+      _batch_offsets[batches] = pos;
+      t_bus_frame frame;
+      for (int b = 0; b < board_count; b++)
+        if (touched[b] && prepare_half_digit(b, boards[b], touched_count > 1, &frame))
+          fits &= store_frame(frame, pos);
+      if (prepare_commit(&frame))
+        fits &= store_frame(frame, pos);
+      steps[batches] = {at, play_batch, batches, wait ? boards_idle : NULL};
+    }
+    batches++;
+  }
+  if (steps)
+    _batch_offsets[batches] = pos;
+
+  duration = (last_end + 999) / 1000;
+  return fits ? batches : -1;
+}
+
+bool timeline_play(const t_timeline_keyframe *keyframes, int count, int h, int m)
+{
+  float scale = 1 / sqrt(get_speed_multiplier());
+  count = expand_keyframes(keyframes, count, scale);
+  if (count <= 0)
+    return false;
+
+  // Frames of a cancelled timeline were prepared but never sent
+  animation_cancel();
+
+  t_animation_step steps[TIMELINE_MAX_KEYFRAMES];
+  unsigned long duration;
+  int batches = build_batches(count, h, m, steps, duration);
+  if (batches < 0)
+  {
+    resync_boards();
+    return false;
+  }
+  animation_start(steps, batches, resync_boards);
+  return true;
+}
+
+unsigned long timeline_duration(const t_timeline_keyframe *keyframes, int count, int h, int m)
+{
+  float scale = 1 / sqrt(get_speed_multiplier());
+  count = expand_keyframes(keyframes, count, scale);
+  if (count <= 0)
+    return 0;
+
+  unsigned long duration;
+  build_batches(count, h, m, NULL, duration);
+  return duration;
+}
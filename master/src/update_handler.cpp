@@ -1,22 +1,54 @@
 #include "update_handler.h"
 #include "status_led.h"
 #include "board_definitions.h"
+#include "choreography.h"
+#include "clock_config.h"
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <StreamString.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/version.h>
+
+#define SHA256_SIZE 32
+#define SHA256_HEADER "X-Firmware-SHA256"
+
+// mbedTLS 3 dropped the _ret suffix from the streaming SHA-256 calls
+#if MBEDTLS_VERSION_NUMBER < 0x03000000
+#define sha256_starts mbedtls_sha256_starts_ret
+#define sha256_update mbedtls_sha256_update_ret
+#define sha256_finish mbedtls_sha256_finish_ret
+#else
+#define sha256_starts mbedtls_sha256_starts
+#define sha256_update mbedtls_sha256_update
+#define sha256_finish mbedtls_sha256_finish
+#endif
+
+// Downloads go through OTA_FETCH_BUFFERS buffers, a flash sector each
+#define OTA_FETCH_BUFFERS 2
+#define OTA_FETCH_BUFFER_SIZE 4096
+// A download with no data for this long is given up, ms
+#define OTA_FETCH_STALL_MS 10000
+#define OTA_TASK_PRIORITY 1
+// TLS runs in the fetch task
+#define OTA_FETCH_TASK_STACK 8192
+#define OTA_WRITE_TASK_STACK 4096
 
-// Forward declaration
-extern void shutdown();
+typedef struct
+{
+    uint8_t *data;
+    size_t len;     // 0 stops the write task
+} t_fetch_chunk;
 
-// Update progress tracking
+// Update progress tracking. Fetches write it from their own tasks while
+// the web server reads it, a status request may see a mix of two updates
 typedef struct
 {
-    bool in_progress;
-    size_t current_size;
+    volatile bool in_progress;
+    volatile size_t current_size;
     size_t total_size;
-    String error_message;
-    String status;
+    char error_message[96];
+    const char *status;
     unsigned long start_time;
 } UpdateProgress;
 
@@ -24,6 +56,87 @@ static UpdateProgress _update_progress = {false, 0, 0, "", "idle", 0};
 static WebServer *_server = nullptr;
 static unsigned long _reboot_time = 0;  // Time when device should reboot (0 = no reboot pending)
 
+// Fetches run in a task, the download fills one buffer while the flash
+// write task empties the other
+static TaskHandle_t _fetch_task = NULL;
+static volatile bool _fetch_cancel = false;
+// Set by the fetch task, the clock is stopped from update_handle()
+static volatile bool _fetch_stop_clock = false;
+static volatile bool _fetch_write_failed = false;
+static QueueHandle_t _free_chunks = NULL;   // buffers ready to be filled
+static QueueHandle_t _full_chunks = NULL;   // buffers ready to be flashed
+static SemaphoreHandle_t _fetch_write_done = NULL;
+
+// Digest of the image being written, computed chunk by chunk as it is flashed
+static mbedtls_sha256_context _sha256;
+static bool _sha256_active = false;
+static uint8_t _expected_sha256[SHA256_SIZE];
+static bool _expected_sha256_set = false;
+
+static void set_update_error(const String &message)
+{
+    strncpy(_update_progress.error_message, message.c_str(), sizeof(_update_progress.error_message) - 1);
+    _update_progress.error_message[sizeof(_update_progress.error_message) - 1] = '\0';
+}
+
+/**
+ * Set the digest the next image must match, an empty string clears it.
+ * Anything after the 64 hex digits is ignored, so sha256sum output works as is.
+ */
+static bool set_expected_sha256(const String &hex)
+{
+    _expected_sha256_set = false;
+    String digest = hex;
+    digest.trim();
+    if (digest.length() == 0)
+        return true;
+    if (digest.length() < SHA256_SIZE * 2)
+        return false;
+
+    for (int i = 0; i < SHA256_SIZE * 2; i++)
+    {
+        char c = tolower(digest[i]);
+        uint8_t nibble;
+        if (c >= '0' && c <= '9')
+            nibble = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            nibble = c - 'a' + 10;
+        else
+            return false;
+        if (i % 2 == 0)
+            _expected_sha256[i / 2] = nibble << 4;
+        else
+            _expected_sha256[i / 2] |= nibble;
+    }
+    if (digest.length() > SHA256_SIZE * 2 && !isspace(digest[SHA256_SIZE * 2]))
+        return false;
+
+    _expected_sha256_set = true;
+    return true;
+}
+
+/**
+ * Release the hash context, it may hold the hardware SHA engine until freed
+ */
+static void release_sha256()
+{
+    if (_sha256_active)
+    {
+        mbedtls_sha256_free(&_sha256);
+        _sha256_active = false;
+    }
+}
+
+/**
+ * Abort the flash write and drop the running digest
+ */
+static void abort_update()
+{
+    Update.abort();
+    release_sha256();
+    _expected_sha256_set = false;
+}
+
 /**
  * Verify that a firmware file is valid
  */
@@ -34,7 +147,7 @@ bool verify_firmware_signature(const uint8_t *buf, size_t len)
     {
         return false;
     }
-    // Should maybe probably possibly do a sha256 check since CI provides it but eh
+    // Integrity is checked against the expected SHA-256 in finish_update()
     return true;
 }
 
@@ -46,13 +159,10 @@ bool start_update(size_t size)
     _update_progress.in_progress = true;
     _update_progress.current_size = 0;
     _update_progress.total_size = size;
-    _update_progress.error_message = "";
+    set_update_error("");
     _update_progress.status = "starting";
     _update_progress.start_time = millis();
 
-    // Shutdown clock operations
-    shutdown();
-
     // Set LED status
     led_set_status(LED_OTA);
 
@@ -62,13 +172,19 @@ bool start_update(size_t size)
     {
         StreamString str;
         Update.printError(str);
-        _update_progress.error_message = str.c_str();
+        set_update_error(str.c_str());
         _update_progress.in_progress = false;
         _update_progress.status = "error";
-        Serial.println("Failed to start update: " + _update_progress.error_message);
+        Serial.printf("Failed to start update: %s\n", _update_progress.error_message);
+        _expected_sha256_set = false;
         return false;
     }
 
+    release_sha256();
+    mbedtls_sha256_init(&_sha256);
+    sha256_starts(&_sha256, 0);
+    _sha256_active = true;
+
     return true;
 }
 
@@ -85,18 +201,19 @@ bool write_update_chunk(const uint8_t *data, size_t len)
     size_t written = Update.write((uint8_t *)data, len);
     if (written != len)
     {
-        _update_progress.error_message = "Failed to write firmware data";
+        set_update_error("Failed to write firmware data");
         _update_progress.status = "error";
         _update_progress.in_progress = false;
-        Update.abort();
+        abort_update();
         Serial.println("Write failed");
         return false;
     }
 
+    // Hash the same buffer that was just written, the image is never read back
+    sha256_update(&_sha256, data, len);
+
     _update_progress.current_size += written;
     _update_progress.status = "uploading";
-
-    led_update();
     return true;
 }
 
@@ -112,11 +229,39 @@ bool finish_update()
 
     _update_progress.status = "finishing";
 
+    uint8_t digest[SHA256_SIZE];
+    sha256_finish(&_sha256, digest);
+    release_sha256();
+
+    if (_expected_sha256_set)
+    {
+        // Constant time compare, the digest is not secret but there is no reason to leak it
+        uint8_t diff = 0;
+        for (int i = 0; i < SHA256_SIZE; i++)
+            diff |= digest[i] ^ _expected_sha256[i];
+
+        if (diff != 0)
+        {
+            set_update_error("Firmware SHA-256 mismatch");
+            _update_progress.status = "error";
+            _update_progress.in_progress = false;
+            abort_update();
+            Serial.println("Update error: SHA-256 mismatch");
+            return false;
+        }
+        Serial.println("Firmware SHA-256 verified");
+    }
+    else
+    {
+        Serial.println("No SHA-256 provided, firmware not verified");
+    }
+    _expected_sha256_set = false;
+
     if (!Update.end(true))
     {
         StreamString str;
         Update.printError(str);
-        _update_progress.error_message = str.c_str();
+        set_update_error(str.c_str());
         _update_progress.status = "error";
         _update_progress.in_progress = false;
         return false;
@@ -147,9 +292,18 @@ void handle_update_upload()
     {
         Serial.printf("Update started: %s\n", upload.filename.c_str());
 
-        if (!start_update(upload.totalSize))
+        if (!set_expected_sha256(_server->header(SHA256_HEADER)))
+        {
+            error_msg = "Invalid SHA-256 header";
+            set_update_error(error_msg);
+            _update_progress.status = "error";
+        }
+        else
         {
-            error_msg = _update_progress.error_message;
+            // Shutdown clock operations
+            choreography_shutdown();
+            if (!start_update(upload.totalSize))
+                error_msg = _update_progress.error_message;
         }
     }
     else if (upload.status == UPLOAD_FILE_WRITE)
@@ -161,10 +315,10 @@ void handle_update_upload()
             {
                 if (!verify_firmware_signature(upload.buf, upload.currentSize))
                 {
-                    _update_progress.error_message = "Invalid firmware signature";
+                    set_update_error("Invalid firmware signature");
                     _update_progress.status = "error";
                     _update_progress.in_progress = false;
-                    Update.abort();
+                    abort_update();
                     error_msg = "Invalid firmware file";
                 }
             }
@@ -173,6 +327,7 @@ void handle_update_upload()
             {
                 error_msg = _update_progress.error_message;
             }
+            led_update();
         }
     }
     else if (upload.status == UPLOAD_FILE_END)
@@ -187,20 +342,20 @@ void handle_update_upload()
         else if (_update_progress.in_progress)
         {
             error_msg = "Upload size mismatch";
-            _update_progress.error_message = error_msg;
+            set_update_error(error_msg);
             _update_progress.status = "error";
             _update_progress.in_progress = false;
-            Update.abort();
+            abort_update();
         }
     }
     else if (upload.status == UPLOAD_FILE_ABORTED)
     {
         if (_update_progress.in_progress)
         {
-            _update_progress.error_message = "Upload cancelled";
+            set_update_error("Upload cancelled");
             _update_progress.status = "error";
             _update_progress.in_progress = false;
-            Update.abort();
+            abort_update();
         }
     }
 
@@ -232,47 +387,152 @@ void handle_get_update_status()
 }
 
 /**
- * Handle POST request to /api/update/fetch from GitHub
+ * Fetch the expected digest published next to a firmware image, if there is one
  */
-void handle_post_update_fetch()
+static void fetch_expected_sha256(WiFiClientSecure &client, const String &url)
 {
-    if (!_server)
+    HTTPClient http;
+    if (!http.begin(client, url))
         return;
+    http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
 
-    // Parse JSON body
-    String body = _server->arg("plain");
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, body);
+    int httpCode = http.GET();
+    if (httpCode == HTTP_CODE_OK && set_expected_sha256(http.getString()))
+    {
+        Serial.println("Expected SHA-256 fetched");
+    }
+    else
+    {
+        Serial.printf("No SHA-256 available (HTTP %d)\n", httpCode);
+    }
+    http.end();
+}
 
-    if (error)
+/**
+ * Flash side of a fetch, writes the buffers the download task fills and
+ * hands them back. Runs until it is sent an empty chunk.
+ */
+static void fetch_write_task(void *param)
+{
+    t_fetch_chunk chunk;
+    while (xQueueReceive(_full_chunks, &chunk, portMAX_DELAY) == pdTRUE && chunk.len > 0)
     {
-        _server->send(400, "application/json",
-                      "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
-        return;
+        // After a failed write the buffers are only drained
+        if (!_fetch_write_failed && !write_update_chunk(chunk.data, chunk.len))
+            _fetch_write_failed = true;
+        xQueueSend(_free_chunks, &chunk, portMAX_DELAY);
     }
+    xSemaphoreGive(_fetch_write_done);
+    vTaskDelete(NULL);
+}
 
-    String url = doc["url"] | "";
+/**
+ * Fill a buffer from the network
+ * @return false if the stream stalled, closed or the fetch was cancelled
+ *         before len bytes came in
+ */
+static bool read_chunk(WiFiClient *stream, uint8_t *data, size_t len)
+{
+    size_t received = 0;
+    unsigned long last_data = millis();
+    while (received < len)
+    {
+        if (_fetch_cancel)
+            return false;
+        int c = stream->read(data + received, len - received);
+        if (c > 0)
+        {
+            received += c;
+            last_data = millis();
+        }
+        else if (!stream->connected() || millis() - last_data > OTA_FETCH_STALL_MS)
+            return false;
+        else
+            vTaskDelay(1);
+    }
+    return true;
+}
 
-    if (url.length() == 0)
+/**
+ * Stream the image into flash, the network fills one buffer while the
+ * other is being written
+ * @return true if every byte was written, the update is still to finish
+ */
+static bool stream_firmware(WiFiClient *stream, size_t total)
+{
+    uint8_t *buffers = (uint8_t *)malloc(OTA_FETCH_BUFFERS * OTA_FETCH_BUFFER_SIZE);
+    if (!buffers)
     {
-        _server->send(400, "application/json",
-                      "{\"status\":\"error\",\"message\":\"URL is required\"}");
-        return;
+        set_update_error("Out of memory");
+        return false;
     }
 
-    _update_progress.status = "fetching";
-    _update_progress.in_progress = true;
-    _update_progress.current_size = 0;
-    _update_progress.total_size = 0;
-    _update_progress.error_message = "";
-    _update_progress.start_time = millis();
+    xQueueReset(_free_chunks);
+    xQueueReset(_full_chunks);
+    for (int i = 0; i < OTA_FETCH_BUFFERS; i++)
+    {
+        t_fetch_chunk chunk = {buffers + i * OTA_FETCH_BUFFER_SIZE, 0};
+        xQueueSend(_free_chunks, &chunk, 0);
+    }
+    _fetch_write_failed = false;
+    if (xTaskCreate(fetch_write_task, "ota_write", OTA_WRITE_TASK_STACK, NULL, OTA_TASK_PRIORITY, NULL) != pdPASS)
+    {
+        free(buffers);
+        set_update_error("Failed to start flash write task");
+        return false;
+    }
 
-    _server->send(200, "application/json",
-                  "{\"status\":\"started\",\"message\":\"Firmware download started\"}");
+    size_t received = 0;
+    bool ok = true;
+    while (received < total && ok)
+    {
+        t_fetch_chunk chunk;
+        // Both buffers are with the writer while the flash is busy
+        if (xQueueReceive(_free_chunks, &chunk, pdMS_TO_TICKS(100)) != pdTRUE)
+        {
+            if (_fetch_cancel)
+                set_update_error("Update cancelled by user");
+            ok = !_fetch_write_failed && !_fetch_cancel;
+            continue;
+        }
+
+        chunk.len = total - received < OTA_FETCH_BUFFER_SIZE ? total - received : OTA_FETCH_BUFFER_SIZE;
+        if (_fetch_write_failed)
+            ok = false;
+        else if (!read_chunk(stream, chunk.data, chunk.len))
+        {
+            set_update_error(_fetch_cancel ? "Update cancelled by user" : "Download interrupted");
+            ok = false;
+        }
+        // Verify firmware signature on first chunk
+        else if (received == 0 && !verify_firmware_signature(chunk.data, chunk.len))
+        {
+            set_update_error("Invalid firmware signature");
+            ok = false;
+        }
+
+        if (ok)
+        {
+            received += chunk.len;
+            xQueueSend(_full_chunks, &chunk, portMAX_DELAY);
+        }
+        else
+            xQueueSend(_free_chunks, &chunk, 0);
+    }
 
-    // Synchronous fetch - blocks server during download but simplifies implementation
-    // UI displays a waiting message during this period
+    // Let the writer flush what it has and stop
+    t_fetch_chunk end = {NULL, 0};
+    xQueueSend(_full_chunks, &end, portMAX_DELAY);
+    xSemaphoreTake(_fetch_write_done, portMAX_DELAY);
+    free(buffers);
+    return ok && !_fetch_write_failed;
+}
 
+/**
+ * Download an image and flash it, runs in its own task
+ */
+static void fetch_firmware(const String &url)
+{
     // Create HTTPS client
     WiFiClientSecure client;
     client.setInsecure(); // Disable certificate verification for GitHub
@@ -281,8 +541,8 @@ void handle_post_update_fetch()
     if (!http.begin(client, url))
     {
         _update_progress.status = "error";
+        set_update_error("Failed to initialize HTTP client");
         _update_progress.in_progress = false;
-        _update_progress.error_message = "Failed to initialize HTTP client";
         Serial.println("Update error: HTTP init failed");
         return;
     }
@@ -290,12 +550,18 @@ void handle_post_update_fetch()
     // Follow redirects (GitHub releases use 302 redirects)
     http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
 
+    // Without an explicit digest, use the .sha256 file CI publishes next to each binary
+    if (!_expected_sha256_set)
+    {
+        fetch_expected_sha256(client, url + ".sha256");
+    }
+
     int httpCode = http.GET();
     if (httpCode != HTTP_CODE_OK)
     {
         _update_progress.status = "error";
+        set_update_error("HTTP error: " + String(httpCode));
         _update_progress.in_progress = false;
-        _update_progress.error_message = "HTTP error: " + String(httpCode);
         http.end();
         Serial.printf("Update error: HTTP %d\n", httpCode);
         return;
@@ -305,66 +571,118 @@ void handle_post_update_fetch()
     if (totalSize <= 0)
     {
         _update_progress.status = "error";
+        set_update_error("Invalid content length");
         _update_progress.in_progress = false;
-        _update_progress.error_message = "Invalid content length";
         http.end();
         return;
     }
 
-    _update_progress.total_size = totalSize;
-
+    // The choreography only takes commands from the network task
+    _fetch_stop_clock = true;
     if (!start_update(totalSize))
     {
         http.end();
         return;
     }
 
-    // Stream the firmware download
-    WiFiClient *stream = http.getStreamPtr();
-    int len = totalSize;
-    uint8_t buff[512] = {0};
+    bool streamed = stream_firmware(http.getStreamPtr(), totalSize);
+    http.end();
 
-    while (http.connected() && (len > 0 || len == -1))
+    if (!streamed)
     {
-        size_t size = stream->available();
-        if (size)
+        // A failed flash write already aborted the update
+        if (_update_progress.in_progress)
         {
-            int c = stream->readBytes(buff, ((size > sizeof(buff)) ? sizeof(buff) : size));
+            _update_progress.status = _fetch_cancel ? "cancelled" : "error";
+            _update_progress.in_progress = false;
+            abort_update();
+        }
+        Serial.printf("Update error: %s\n", _update_progress.error_message);
+        return;
+    }
 
-            // Verify firmware signature on first chunk
-            if (_update_progress.current_size == 0)
-            {
-                if (!verify_firmware_signature(buff, c))
-                {
-                    _update_progress.error_message = "Invalid firmware signature";
-                    _update_progress.status = "error";
-                    _update_progress.in_progress = false;
-                    Update.abort();
-                    http.end();
-                    return;
-                }
-            }
+    finish_update();
+}
 
-            if (!write_update_chunk(buff, c))
-            {
-                http.end();
-                return;
-            }
+static void fetch_task(void *param)
+{
+    String *url = (String *)param;
+    fetch_firmware(*url);
+    delete url;
+    _fetch_task = NULL;
+    vTaskDelete(NULL);
+}
 
-            if (len > 0)
-            {
-                len -= c;
-            }
-        }
-        delay(1); // Allow background tasks
+/**
+ * Handle POST request to /api/update/fetch from GitHub
+ */
+void handle_post_update_fetch()
+{
+    if (!_server)
+        return;
+
+    // A finished fetch task may still be tearing down its connection
+    if (_update_progress.in_progress || _fetch_task)
+    {
+        _server->send(409, "application/json",
+                      "{\"status\":\"error\",\"message\":\"Update already in progress\"}");
+        return;
     }
 
-    http.end();
+    // Parse JSON body
+    String body = _server->arg("plain");
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, body);
 
-    if (_update_progress.in_progress)
+    if (error)
+    {
+        _server->send(400, "application/json",
+                      "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
+        return;
+    }
+
+    String url = doc["url"] | "";
+    String sha256 = doc["sha256"] | "";
+
+    if (url.length() == 0)
+    {
+        _server->send(400, "application/json",
+                      "{\"status\":\"error\",\"message\":\"URL is required\"}");
+        return;
+    }
+
+    if (!set_expected_sha256(sha256))
     {
-        finish_update();
+        _server->send(400, "application/json",
+                      "{\"status\":\"error\",\"message\":\"Invalid SHA-256\"}");
+        return;
     }
+
+    _update_progress.status = "fetching";
+    _update_progress.in_progress = true;
+    _update_progress.current_size = 0;
+    _update_progress.total_size = 0;
+    set_update_error("");
+    _update_progress.start_time = millis();
+
+    // The download runs in the background, the status endpoint reports progress
+    String *fetch_url = new String(url);
+    _fetch_cancel = false;
+    if (xTaskCreate(fetch_task, "ota_fetch", OTA_FETCH_TASK_STACK, fetch_url, OTA_TASK_PRIORITY, &_fetch_task) != pdPASS)
+    {
+        delete fetch_url;
+        _fetch_task = NULL;
+        _update_progress.status = "error";
+        set_update_error("Failed to start download task");
+        _update_progress.in_progress = false;
+        _expected_sha256_set = false;
+        _server->send(500, "application/json",
+                      "{\"status\":\"error\",\"message\":\"Failed to start download task\"}");
+        return;
+    }
+
+    _server->send(200, "application/json",
+                  "{\"status\":\"started\",\"message\":\"Firmware download started\"}");
 }
 
 /**
@@ -400,15 +718,31 @@ void update_init(WebServer *server)
     _server->on("/api/update/cancel", HTTP_POST, handle_post_update_cancel);
     _server->on("/api/update/target", HTTP_GET, handle_get_update_target);
 
+    // The upload handler only sees headers the server was told to keep
+    const char *headers[] = {SHA256_HEADER};
+    _server->collectHeaders(headers, 1);
+
+    _free_chunks = xQueueCreate(OTA_FETCH_BUFFERS, sizeof(t_fetch_chunk));
+    _full_chunks = xQueueCreate(OTA_FETCH_BUFFERS + 1, sizeof(t_fetch_chunk));
+    _fetch_write_done = xSemaphoreCreateBinary();
+
     Serial.println("Update handler initialized");
 }
 
 void update_handle()
 {
+    if (_fetch_stop_clock)
+    {
+        _fetch_stop_clock = false;
+        // Shutdown clock operations
+        choreography_shutdown();
+    }
+
     // Check if scheduled reboot time has arrived
     if (_reboot_time > 0 && millis() >= _reboot_time)
     {
         _reboot_time = 0;  // Clear the reboot timer
+        flush_config();    // Settings still waiting to be written
         ESP.restart();
     }
 }
@@ -426,11 +760,11 @@ String update_get_status()
              "{\"in_progress\":%s,\"status\":\"%s\",\"progress\":%d,\"current\":%d,"
              "\"total\":%d,\"error\":\"%s\",\"elapsed\":%lu}",
              _update_progress.in_progress ? "true" : "false",
-             _update_progress.status.c_str(),
+             _update_progress.status,
              percent,
              _update_progress.current_size,
              _update_progress.total_size,
-             _update_progress.error_message.c_str(),
+             _update_progress.error_message,
              _update_progress.in_progress ? (millis() - _update_progress.start_time) : 0);
 
     return String(json);
@@ -445,7 +779,7 @@ void schedule_restart(unsigned long delay_ms)
 {
     if (_update_progress.in_progress) return; // Don't allow scheduling a restart during an update
 
-    shutdown();
+    choreography_shutdown();
     led_set_status(LED_ERROR);
     _reboot_time = millis() + delay_ms;
     Serial.printf("Restart scheduled in %lums\n", delay_ms);
@@ -453,11 +787,17 @@ void schedule_restart(unsigned long delay_ms)
 
 void update_cancel()
 {
+    // The fetch task owns the update, it aborts at the next buffer
+    if (_fetch_task)
+    {
+        _fetch_cancel = true;
+        return;
+    }
     if (_update_progress.in_progress)
     {
-        Update.abort();
+        abort_update();
         _update_progress.in_progress = false;
         _update_progress.status = "cancelled";
-        _update_progress.error_message = "Update cancelled by user";
+        set_update_error("Update cancelled by user");
     }
 }
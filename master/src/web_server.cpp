@@ -2,6 +2,9 @@
 #include "clock_config.h"
 #include "update_handler.h"
 #include "mqtt_handler.h"
+#include "choreography.h"
+#include "bus_manager.h"
+#include "time_zone.h"
 
 WebServer _server(80);
 
@@ -12,6 +15,16 @@ bool _time_changed_browser = false;
 void handle_get_daily_restart();
 void handle_post_daily_restart();
 
+/**
+ * Checks a time zone before anything is applied, once saved the clock
+ * switches to it from the main loop
+*/
+static bool is_valid_timezone(const String &value)
+{
+  t_time_zone zone;
+  return tz_parse(value.c_str(), &zone);
+}
+
 void handle_captive_portal()
 {
   // Redirect all unknown requests to root (for captive portal)
@@ -74,7 +87,7 @@ void handle_get()
 void handle_get_config()
 {
   Serial.println("Handle GET /config");
-  char payload[1024];
+  char payload[1152];
   {
     char s_time[512] = "[";
     for (int i = 0; i < 7; i++)
@@ -99,6 +112,9 @@ void handle_get_config()
       "\"password\":\"%s\","
       "\"hostname\":\"%s\","
       "\"speed_multiplier\":%d,"
+      "\"boards\":%d,"
+      "\"bus_clock\":%lu,"
+      "\"tz\":\"%s\","
       "\"mqtt_enabled\":%s,"
       "\"mqtt_broker\":\"%s\","
       "\"mqtt_port\":%d,"
@@ -108,8 +124,8 @@ void handle_get_config()
       "\"sleep_time\":%s}",
       get_clock_animation_mode(), get_clock_enabled() ? "true" : "false", 
       get_connection_mode(), get_ssid(), get_password(), get_hostname(), 
-      get_speed_multiplier(), 
-      get_mqtt_enabled() ? "true" : "false", get_mqtt_broker(), 
+      get_speed_multiplier(), get_boards(), (unsigned long)get_bus_clock(),
+      get_timezone(), get_mqtt_enabled() ? "true" : "false", get_mqtt_broker(), 
       get_mqtt_port(), get_mqtt_username(), 
       get_daily_restart_enabled() ? "true" : "false", 
       get_daily_restart_hour(), 
@@ -121,18 +137,32 @@ void handle_get_config()
 void handle_get_system()
 {
   Serial.println("Handle GET /system");
-  char payload[96];
+  static char payload[128 + MAX_BOARDS * BUS_HEALTH_JSON_SIZE];
   unsigned long uptime_seconds = millis() / 1000; // millis will wrap every ~49 days
-  snprintf(payload, sizeof(payload),
-           "{\"free_heap\":%lu,\"uptime\":%lu}",
+  size_t len = snprintf(payload, sizeof(payload),
+           "{\"free_heap\":%lu,\"uptime\":%lu,\"boards\":%d,\"bus_clock\":%lu,\"bus\":[",
            (unsigned long)ESP.getFreeHeap(),
-           uptime_seconds);
+           uptime_seconds,
+           get_board_count(),
+           (unsigned long)bus_get_clock());
+  for (int i = 0; i < get_board_count(); i++)
+  {
+    if (i > 0)
+      payload[len++] = ',';
+    len += bus_health_json(payload + len, sizeof(payload) - len, i + 1);
+  }
+  snprintf(payload + len, sizeof(payload) - len, "]}");
   _server.send(200, "application/json", payload);
 }
 
 void handle_post_time()
 {
   Serial.println("Handle POST /time");
+  if (_server.hasArg("tz") && !is_valid_timezone(_server.arg("tz")))
+  {
+    _server.send(400, "text/plain", "Invalid POSIX TZ string");
+    return;
+  }
   if (_server.hasArg("h"))
     _browser_time.hour = _server.arg("h").toInt();
   if (_server.hasArg("m"))
@@ -145,10 +175,14 @@ void handle_post_time()
     _browser_time.month = _server.arg("M").toInt();
   if (_server.hasArg("Y"))
     _browser_time.year = _server.arg("Y").toInt();
-  if (_server.hasArg("timezone"))
+  if (_server.hasArg("tz"))
+    set_timezone(_server.arg("tz").c_str());
+  else if (_server.hasArg("timezone"))
   {
-    int _browser_timezone = _server.arg("timezone").toInt();
-    set_timezone(_browser_timezone);
+    // Hours east of UTC from older pages, half hours come as 5.5
+    char posix[TZ_STRING_SIZE];
+    tz_fixed(lround(_server.arg("timezone").toFloat() * 60), posix);
+    set_timezone(posix);
   }
   _time_changed_browser = true;
   _server.send(200, "text/plain", "");
@@ -173,7 +207,7 @@ void handle_post_adjust()
 
   Serial.printf("Adjust received, clock: %d, m_amount: %d, h_amount: %d\n",
                 clock_index, m_amount, h_amount);
-  adjust_hands(clock_index, m_amount, h_amount);
+  choreography_adjust(clock_index, m_amount, h_amount);
 }
 
 void handle_post_mode()
@@ -192,8 +226,31 @@ void handle_post_mode()
 void handle_post_settings()
 {
   Serial.println("Handle POST /settings");
+  // Nothing is applied unless every field is valid
+  const char *error = NULL;
+  if (_server.hasArg("multiplier") && _server.arg("multiplier").toInt() < 1)
+    error = "Invalid multiplier";
+  else if (_server.hasArg("boards") &&
+           (_server.arg("boards").toInt() < 0 || _server.arg("boards").toInt() > MAX_BOARDS))
+    error = "Invalid number of boards";
+  else if (_server.hasArg("bus_clock") && _server.arg("bus_clock").toInt() < 0)
+    error = "Invalid bus clock";
+  else if (_server.hasArg("tz") && !is_valid_timezone(_server.arg("tz")))
+    error = "Invalid POSIX TZ string";
+  if (error)
+  {
+    _server.send(400, "text/plain", error);
+    return;
+  }
+
   if (_server.hasArg("multiplier"))
     set_speed_multiplier(_server.arg("multiplier").toInt());
+  if (_server.hasArg("boards"))
+    set_boards(_server.arg("boards").toInt());
+  if (_server.hasArg("bus_clock"))
+    set_bus_clock(_server.arg("bus_clock").toInt());
+  if (_server.hasArg("tz"))
+    set_timezone(_server.arg("tz").c_str());
   _server.send(200, "text/plain", "");
 }
 
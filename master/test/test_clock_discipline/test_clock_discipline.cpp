@@ -0,0 +1,109 @@
+/**
+ * Clock discipline on virtual time, run with: pio test -e native
+ * The sources are built in, like the simulated slaves, so the test can
+ * start every case from an unsynced clock.
+*/
+
+#include <unity.h>
+
+#include "../../sim/shim/Arduino.cpp"
+#include "../../src/clock_discipline.cpp"
+
+// Unix time in ms at millis() 0, the true time runs at the crystal's rate
+#define TEST_EPOCH_MS 1700000000000LL
+// Round trip of an exchange, ms
+#define TEST_DELAY_MS 20
+
+static int64_t true_ms(unsigned long at)
+{
+  return TEST_EPOCH_MS + at;
+}
+
+/**
+ * Runs a whole burst against a server whose time is shifted from the
+ * true time
+*/
+static void burst(int64_t shift_ms)
+{
+  for (int i = 0; i < DISCIPLINE_BURST; i++)
+  {
+    t_ntp_sample sample;
+    sample.sent = millis();
+    sim_advance_us(TEST_DELAY_MS * 1000ULL);
+    sample.received = millis();
+    sample.server_rx = true_ms(sample.sent + TEST_DELAY_MS / 2) + shift_ms;
+    sample.server_tx = sample.server_rx;
+    discipline_add_sample(sample);
+    sim_advance_us(2000000ULL);
+  }
+}
+
+static void sync(int64_t shift_ms)
+{
+  burst(shift_ms);
+  discipline_update();
+}
+
+/**
+ * Syncs once, then with a server moved by offset_ms, and checks every ms
+ * until the next sync that the clock never goes back or jumps, and that
+ * it reaches the server in the end
+*/
+static void check_slew(int64_t offset_ms)
+{
+  sync(0);
+  sim_advance_us(DISCIPLINE_MIN_POLL * 1000000ULL);
+  burst(offset_ms);
+  int64_t before = discipline_time_ms(millis());
+  discipline_update();
+  TEST_ASSERT_INT_WITHIN(1, 0, (int32_t)(discipline_time_ms(millis()) - before));
+
+  unsigned long start = millis();
+  unsigned long span = discipline_poll_interval();
+  int64_t last = discipline_time_ms(start - 1);
+  for (unsigned long at = start; at <= start + span; at++)
+  {
+    int64_t time = discipline_time_ms(at);
+    TEST_ASSERT_TRUE_MESSAGE(time >= last, "clock went back");
+    TEST_ASSERT_TRUE_MESSAGE(time - last <= 3, "clock jumped");
+    last = time;
+  }
+  TEST_ASSERT_INT_WITHIN(2, (int32_t)offset_ms, (int32_t)(last - true_ms(start + span)));
+}
+
+void setUp()
+{
+  _disciplined = false;
+  _sample_count = 0;
+}
+
+void tearDown()
+{
+}
+
+void test_offset_ahead_is_slewed()
+{
+  check_slew(200);
+}
+
+void test_offset_behind_is_slewed()
+{
+  check_slew(-200);
+}
+
+void test_large_offset_is_stepped()
+{
+  sync(0);
+  sim_advance_us(DISCIPLINE_MIN_POLL * 1000000ULL);
+  sync(2000);
+  TEST_ASSERT_INT_WITHIN(2, 2000, (int32_t)(discipline_time_ms(millis()) - true_ms(millis())));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_offset_ahead_is_slewed);
+  RUN_TEST(test_offset_behind_is_slewed);
+  RUN_TEST(test_large_offset_is_stepped);
+  return UNITY_END();
+}
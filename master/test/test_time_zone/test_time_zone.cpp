@@ -0,0 +1,125 @@
+/**
+ * POSIX TZ strings and DST changes, run with: pio test -e native
+ * Expected times are UTC, worked out from the calendar.
+*/
+
+#include <unity.h>
+
+#include "../../src/time_zone.cpp"
+
+#define HOUR 3600
+
+static int32_t offset_at(time_t utc)
+{
+  return (int32_t)(tz_local(utc) - utc);
+}
+
+/**
+ * Checks the offset in force just before and right at a change
+*/
+static void check_change(time_t change, int32_t before, int32_t after)
+{
+  TEST_ASSERT_EQUAL_INT32(before, offset_at(change - 1));
+  TEST_ASSERT_EQUAL_INT32(after, offset_at(change));
+}
+
+void setUp()
+{
+  tz_set(TZ_DEFAULT);
+}
+
+void tearDown()
+{
+}
+
+void test_northern_zone_changes()
+{
+  TEST_ASSERT_TRUE(tz_set("CET-1CEST,M3.5.0,M10.5.0/3"));
+  // 2025-03-30 02:00 CET and 2025-10-26 03:00 CEST
+  check_change(1743296400, 1 * HOUR, 2 * HOUR);
+  check_change(1761440400, 2 * HOUR, 1 * HOUR);
+  // Back to spring, the cached offset is looked up again
+  TEST_ASSERT_EQUAL_INT32(2 * HOUR, offset_at(1743296400 + 30 * 24 * HOUR));
+}
+
+void test_southern_zone_across_new_year()
+{
+  TEST_ASSERT_TRUE(tz_set("AEST-10AEDT,M10.1.0,M4.1.0/3"));
+  // DST runs over New Year, 2024-12-31 23:00 and 2025-01-01 00:30 UTC
+  TEST_ASSERT_EQUAL_INT32(11 * HOUR, offset_at(1735686000));
+  TEST_ASSERT_EQUAL_INT32(11 * HOUR, offset_at(1735691400));
+  // 2025-04-06 03:00 AEDT and 2025-10-05 02:00 AEST
+  check_change(1743868800, 11 * HOUR, 10 * HOUR);
+  check_change(1759593600, 10 * HOUR, 11 * HOUR);
+}
+
+void test_half_hour_fixed_zone()
+{
+  char posix[TZ_STRING_SIZE];
+  tz_fixed(330, posix);
+  TEST_ASSERT_EQUAL_STRING("<+0530>-5:30", posix);
+  TEST_ASSERT_TRUE(tz_set(posix));
+  TEST_ASSERT_EQUAL_INT32(5 * HOUR + 30 * 60, offset_at(0));
+  TEST_ASSERT_EQUAL_INT32(5 * HOUR + 30 * 60, offset_at(1735686000));
+
+  tz_fixed(-570, posix);
+  TEST_ASSERT_TRUE(tz_set(posix));
+  TEST_ASSERT_EQUAL_INT32(-(9 * HOUR + 30 * 60), offset_at(1735686000));
+}
+
+void test_julian_days_in_leap_year()
+{
+  // Jn never counts February 29, J60 is March 1 even in 2024
+  TEST_ASSERT_TRUE(tz_set("AAA0BBB,J60/0,J300/0"));
+  check_change(1709251200, 0, HOUR);
+  // n counts it, day 59 of 2024 is February 29
+  TEST_ASSERT_TRUE(tz_set("AAA0BBB,59/0,J300/0"));
+  check_change(1709164800, 0, HOUR);
+  // J60 in a common year, 2025-03-01
+  TEST_ASSERT_TRUE(tz_set("AAA0BBB,J60/0,J300/0"));
+  check_change(1740787200, 0, HOUR);
+}
+
+void test_malformed_strings_rejected()
+{
+  const char *invalid[] = {
+    "",
+    "CET",                              // no offset
+    "AB-1",                             // name too short
+    "<+05",                             // name not closed
+    "CET-25",                           // offset out of range
+    "CET-1CEST,M3.5.0",                 // only one rule
+    "CET-1CEST,M13.5.0,M10.5.0/3",      // month 13
+    "CET-1CEST,M3.6.0,M10.5.0/3",       // week 6
+    "CET-1CEST,M3.5.7,M10.5.0/3",       // weekday 7
+    "CET-1CEST,J0,M10.5.0/3",           // Julian day 0
+    "CET-1CEST,M3.5.0,M10.5.0/3x",      // trailing text
+    "CET-1:60",                         // minutes out of range
+  };
+  t_time_zone zone;
+  for (const char *posix : invalid)
+    TEST_ASSERT_FALSE_MESSAGE(tz_parse(posix, &zone), posix);
+  TEST_ASSERT_FALSE(tz_parse(NULL, &zone));
+
+  char too_long[TZ_STRING_SIZE + 1];
+  memset(too_long, 'A', TZ_STRING_SIZE);
+  too_long[TZ_STRING_SIZE] = '\0';
+  TEST_ASSERT_FALSE(tz_parse(too_long, &zone));
+
+  // The zone in use stays
+  TEST_ASSERT_TRUE(tz_set("CET-1"));
+  TEST_ASSERT_FALSE(tz_set("CET-1CEST,M3.5.0"));
+  TEST_ASSERT_EQUAL_STRING("CET-1", tz_get());
+  TEST_ASSERT_EQUAL_INT32(HOUR, offset_at(1735686000));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_northern_zone_changes);
+  RUN_TEST(test_southern_zone_across_new_year);
+  RUN_TEST(test_half_hour_fixed_zone);
+  RUN_TEST(test_julian_days_in_leap_year);
+  RUN_TEST(test_malformed_strings_rejected);
+  return UNITY_END();
+}
@@ -12,6 +12,13 @@
 */
 void board_begin();
 
+/**
+ * Tells if board_begin() completed, the other core must wait for it
+ * before touching the motors
+ * @return true if the board is initialized
+*/
+bool board_ready();
+
 /**
  * Needs to be called on the main loop to move steppers
 */
@@ -30,6 +37,21 @@ uint8_t get_i2c_address();
 */
 bool clock_is_running(int index);
 
+/**
+ * Fills the motion part of a status block: running clocks, steps left
+ * and hand angles. Reads only what core 1 published after its last motor
+ * update, so core 0 can call it while core 1 moves the motors
+ * @param status    status block
+*/
+void board_fill_status(t_board_status *status);
+
+/**
+ * Fills the per motor part of a stats block: steps and pulse lateness
+ * @param stats         stats block
+ * @param restart_max   start a new worst lateness
+*/
+void board_fill_stats(t_board_stats *stats, bool restart_max);
+
 /**
  * Set the clock state by running motors
  * @param index     clock index (0 <= index =< 3)
@@ -1,21 +1,140 @@
 #ifndef CLOCK_ACCEL_STEPPER_H
 #define CLOCK_ACCEL_STEPPER_H
 
-#include <AccelStepper.h>
+#include <Arduino.h>
 #include "clock_state.h"
 
+// Number of precomputed ramp steps, later steps are extrapolated
+#define RAMP_TABLE_SIZE 256
+// Entries of the S-curve ramp table, indexed by the cube root of the position
+#define SCURVE_TABLE_SIZE 257
+
 /**
- * Subclass specialized on clock movements.
+ * Step/dir stepper driver specialized on clock movements.
+ * Same trapezoidal profile as AccelStepper (Austin's algorithm) but computed
+ * with integer math only: the first RAMP_TABLE_SIZE step intervals come from
+ * a table of Q16 ratios to the first interval, which only depends on the
+ * acceleration, so no float division or sqrt() is done while stepping.
+ * Moves can use a jerk limited S-curve instead, its ramp times also come
+ * from a table, see make_scurve_table().
+ * Pulses are timed by the step generator, the intervals of a move are only
+ * computed ahead of it. Moves are expected to start from rest.
 */
-class ClockAccelStepper : public AccelStepper
+class ClockAccelStepper
 {
   private:
     int _current_angle;
     int _max_steps;
     bool _reverse;
 
+    uint8_t _channel;
+    uint8_t _step_pin;
+    uint8_t _dir_pin;
+
+    long _target_pos;
+    long _move_start;             // position the running move started from
+    uint32_t _move_steps;         // steps of the running move
+    uint32_t _steps_queued;       // steps already handed to the step generator
+    bool _direction;              // true == positive steps
+
+    uint32_t _max_speed;          // steps/s
+    uint32_t _acceleration;       // steps/s^2
+    uint32_t _c0;                 // first step interval, us
+    uint32_t _c_tail;             // last tabled step interval, us
+    uint32_t _cmin;               // step interval at max speed, us
+
+    bool _scurve;                 // moves use S-curve ramps
+    uint32_t _s_ramp_steps;       // steps of the running S-curve ramp
+    uint64_t _s_ramp_time;        // duration of the running S-curve ramp, us
+    uint32_t _s_cmin;             // step interval once the S-curve ramp is done, us
+    uint32_t _s_memo_k[2];        // last ramp times computed, consecutive
+    uint64_t _s_memo_t[2];        // intervals share one of them
+    uint8_t _s_memo_next;
+
+    /**
+     * Interval between a step of the running move and the next one.
+     * @param step    1-based step number
+     * @return interval in us, 0 after the last step
+    */
+    uint32_t stepInterval(uint32_t step);
+
+    /**
+     * Step interval of the ramp after k steps, not limited by max speed.
+     * @param k     ramp position
+    */
+    uint32_t rampInterval(uint32_t k);
+
+    /**
+     * Sets up the S-curve ramp of the move just started.
+    */
+    void planSCurve();
+
+    /**
+     * Time the S-curve ramp takes to cover k steps.
+     * @param k     ramp position
+     * @return time in us
+    */
+    uint64_t sCurveTime(uint32_t k);
+
   public:
-    explicit ClockAccelStepper(uint8_t interface = AccelStepper::FULL4WIRE, uint8_t pin1 = 2, uint8_t pin2 = 3, uint8_t pin3 = 4, uint8_t pin4 = 5, bool enable = true);
+    explicit ClockAccelStepper(uint8_t channel, uint8_t step_pin, uint8_t dir_pin);
+
+    /**
+     * Configures the dir pin and the step generator channel.
+    */
+    void enableOutputs();
+
+    /**
+     * Sets the maximum speed.
+     * @param speed   steps per second
+    */
+    void setMaxSpeed(uint32_t speed);
+
+    /**
+     * Sets the acceleration.
+     * @param acceleration    steps per second per second, 0 is ignored
+    */
+    void setAcceleration(uint32_t acceleration);
+
+    /**
+     * Selects the ramps of the next moves. The S-curve keeps the peak
+     * acceleration to the one set, its ramps take 1.5 times longer.
+     * @param scurve    true for jerk limited S-curve, false for trapezoidal
+    */
+    void setSCurve(bool scurve);
+
+    /**
+     * Sets the target position relative to the current one.
+     * @param relative    steps
+    */
+    void move(long relative);
+
+    /**
+     * Sets the absolute target position, the motor must be stopped.
+     * @param absolute    steps
+    */
+    void moveTo(long absolute);
+
+    /**
+     * Keeps the step generator fed, needs to be called as often as possible.
+     * @return true while the motor is still moving
+    */
+    bool run();
+
+    /**
+     * Blocks until the target position is reached.
+    */
+    void runToPosition();
+
+    /**
+     * @return steps from the current position to the target
+    */
+    long distanceToGo();
+
+    /**
+     * @return current position in steps
+    */
+    long currentPosition();
 
     /**
      * Set clock hand to a specified angle.
@@ -23,6 +142,18 @@ class ClockAccelStepper : public AccelStepper
     */
     void setHandAngle(int angle);
 
+    /**
+     * Angle the hand was last moved to, adjustments excluded.
+     * @return angle (0 <= angle < 360)
+    */
+    int getHandAngle();
+
+    /**
+     * Angle the hand is at right now, worked out from the steps left.
+     * @return angle (0 <= angle < 360)
+    */
+    int currentHandAngle();
+
     /**
      * Reverse clock direction.
      * @param reverse
@@ -59,4 +190,4 @@ class ClockAccelStepper : public AccelStepper
     void moveToAngle(int angle, int direction);
 };
 
-#endif
\ No newline at end of file
+#endif
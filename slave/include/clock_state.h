@@ -1,6 +1,9 @@
 #ifndef CLOCK_STATE_H
 #define CLOCK_STATE_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 enum directions {
     CLOCKWISE,
     CLOCKWISE2,
@@ -17,6 +20,9 @@ enum directions {
     ADJUST_HAND
 };
 
+// t_clock flags
+#define CLOCK_FLAG_SCURVE 0x01  // jerk limited S-curve instead of trapezoidal ramps
+
 typedef struct clock_state {
     uint16_t angle_h;
     uint16_t angle_m;
@@ -28,6 +34,7 @@ typedef struct clock_state {
     uint8_t mode_m;
     signed char adjust_h;
     signed char adjust_m;
+    uint8_t flags;
 } t_clock;
 
 typedef struct half_digit {
@@ -35,4 +42,116 @@ typedef struct half_digit {
     uint32_t change_counter[3];
 } t_half_digit;
 
+/***************** I2C wire format *****************/
+// Bump when the frame layout changes, master and slaves must match
+#define I2C_PROTOCOL_VERSION 4
+
+// Frame header: version, type, length of the whole frame, sequence number.
+// The sequence number counts the frames sent to a board, commits use 0
+#define I2C_FRAME_HEADER_SIZE 4
+// Frames end with the CRC-16 of everything before it, little endian
+#define I2C_FRAME_CRC_SIZE 2
+// Header, epoch, clock mask, three complete clock records and CRC
+#define I2C_MAX_FRAME_SIZE (I2C_FRAME_HEADER_SIZE + 2 + 1 + 3 * (2 + 4 + sizeof(t_clock)) + I2C_FRAME_CRC_SIZE)
+
+// Commit frames are broadcast to every board at once
+#define I2C_GENERAL_CALL 0
+// Board i answers at address i + 1, set by 4 address switches
+#define MAX_BOARDS 15
+
+enum frame_types {
+    FRAME_DELTA = 1,  // delta payload, applied immediately
+    FRAME_STAGE = 2,  // uint16_t epoch + delta payload, held until committed
+    FRAME_COMMIT = 3, // uint16_t epoch, applies the frames staged for it
+    FRAME_SELECT = 4, // uint8_t read block, answered by the next read only
+    FRAME_ECHO = 5    // I2C_ECHO_SIZE bytes of test pattern, sent back by the next read
+};
+
+// Blocks a board answers reads with, the status unless selected otherwise.
+// All start with the version and rx_seq, reading these two bytes tells
+// the master if its last frame got through
+enum read_blocks {
+    READ_STATUS = 0, // t_board_status
+    READ_STATS = 1,  // t_board_stats, its maxima restart once read
+    READ_ECHO = 2    // t_board_echo, selected by FRAME_ECHO
+};
+
+/**
+ * Status block a board answers read requests with
+ */
+typedef struct __attribute__((packed)) board_status {
+    uint8_t version;             // I2C_PROTOCOL_VERSION
+    uint8_t rx_seq;              // sequence number of the last frame accepted
+    uint8_t running;             // bit i set while a hand of clock i moves
+    uint8_t pending;             // bit i set while clock i has keyframes not started yet
+    uint32_t change_counter[3];  // counter of the last keyframe each clock started
+    int16_t distance_to_go[6];   // steps left per hand: h0, m0, h1, m1, h2, m2
+    uint16_t angle[6];           // angle of each hand right now, degrees
+    uint32_t loop_rate;          // core 1 loop iterations per second
+} t_board_status;
+
+// Lateness buckets of step pulses: up to 10 us, 100 us, 1 ms, 10 ms, more
+#define STATS_LATENESS_BUCKETS 5
+
+/**
+ * Stepping engine instrumentation of a board
+ */
+typedef struct __attribute__((packed)) board_stats {
+    uint8_t version;                 // I2C_PROTOCOL_VERSION
+    uint8_t rx_seq;                  // sequence number of the last frame accepted
+    uint32_t rx_frames;              // frames accepted
+    uint32_t rx_crc_errors;          // frames dropped, CRC mismatch
+    uint32_t rx_length_errors;       // frames dropped, truncated, too long or wrong version
+    uint32_t rx_duplicates;          // retransmitted frames already applied
+    uint32_t loop_rate;              // core 1 loop iterations per second
+    uint32_t loop_max_us;            // longest core 1 loop iteration
+    uint16_t lock_wait_max_us[2];    // longest keyframe lock wait: I2C handler, core 1
+    uint32_t steps[6];               // pulses emitted per motor since boot
+    uint16_t late[6][STATS_LATENESS_BUCKETS]; // late pulses per motor by lateness, saturated
+    uint16_t late_max_us[6];         // worst lateness per motor, saturated
+} t_board_stats;
+
+// Test pattern of an echo, long enough to catch a bus run too fast
+#define I2C_ECHO_SIZE 16
+
+/**
+ * Echo block, the pattern of the last FRAME_ECHO sent back
+ */
+typedef struct __attribute__((packed)) board_echo {
+    uint8_t version;                 // I2C_PROTOCOL_VERSION
+    uint8_t rx_seq;                  // sequence number of the last frame accepted
+    uint8_t pattern[I2C_ECHO_SIZE];  // as received
+    uint16_t crc;                    // CRC-16 of the bytes before it
+} t_board_echo;
+
+/**
+ * Delta frame payload:
+ *   uint8_t  clock mask (bit i set if clock i follows)
+ *   per clock in mask:
+ *     uint16_t field mask (bit i set if clock_fields[i] follows)
+ *     uint32_t change counter
+ *     fields in clock_fields order, native size, little endian
+ */
+typedef struct clock_field {
+    uint8_t offset;
+    uint8_t size;
+} t_clock_field;
+
+#define CLOCK_FIELDS_COUNT 11
+#define CLOCK_FIELDS_ALL ((1 << CLOCK_FIELDS_COUNT) - 1)
+
+const t_clock_field clock_fields[CLOCK_FIELDS_COUNT] = {
+    {offsetof(t_clock, angle_h), sizeof(uint16_t)},
+    {offsetof(t_clock, angle_m), sizeof(uint16_t)},
+    {offsetof(t_clock, speed_h), sizeof(uint16_t)},
+    {offsetof(t_clock, speed_m), sizeof(uint16_t)},
+    {offsetof(t_clock, accel_h), sizeof(uint16_t)},
+    {offsetof(t_clock, accel_m), sizeof(uint16_t)},
+    {offsetof(t_clock, mode_h), sizeof(uint8_t)},
+    {offsetof(t_clock, mode_m), sizeof(uint8_t)},
+    {offsetof(t_clock, adjust_h), sizeof(signed char)},
+    {offsetof(t_clock, adjust_m), sizeof(signed char)},
+    {offsetof(t_clock, flags), sizeof(uint8_t)}
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef CLOCK_STEP_PIO_H
+#define CLOCK_STEP_PIO_H
+
+#include <hardware/pio.h>
+
+/**
+ * PIO program emitting one step pulse per word pulled from the TX FIFO,
+ * then waiting (word + CLOCK_STEP_OVERHEAD) cycles before pulling the next.
+ * The step pin is driven by side-set, the state machine runs at 1 MHz so
+ * one cycle is one microsecond.
+ *
+ * .program clock_step
+ * .side_set 1
+ * .wrap_target
+ *     pull block      side 0      ; wait for the next interval, step low
+ *     mov x, osr      side 1 [7]  ; step high for 8 cycles
+ * delay:
+ *     jmp x-- delay   side 0      ; x + 1 cycles
+ * .wrap
+*/
+
+// Cycles spent per step outside of the delay loop
+#define CLOCK_STEP_OVERHEAD 10
+#define CLOCK_STEP_WRAP_TARGET 0
+#define CLOCK_STEP_WRAP 2
+
+static const uint16_t clock_step_program_instructions[] = {
+    //     .wrap_target
+    0x80a0, //  0: pull   block           side 0
+    0xb727, //  1: mov    x, osr          side 1 [7]
+    0x0042, //  2: jmp    x--, 2          side 0
+    //     .wrap
+};
+
+static const struct pio_program clock_step_program = {
+    .instructions = clock_step_program_instructions,
+    .length = 3,
+    .origin = -1,
+};
+
+static inline pio_sm_config clock_step_program_get_default_config(uint offset)
+{
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + CLOCK_STEP_WRAP_TARGET, offset + CLOCK_STEP_WRAP);
+    sm_config_set_sideset(&c, 1, false, false);
+    return c;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef KEYFRAME_QUEUE_H
+#define KEYFRAME_QUEUE_H
+
+#include <stdint.h>
+#include "clock_state.h"
+
+// Must be a power of two
+#define KEYFRAME_QUEUE_SIZE 16
+
+typedef struct keyframe {
+    t_clock clock;
+    uint32_t change_counter;
+} t_keyframe;
+
+/**
+ * Lock-free single producer single consumer ring of keyframes.
+ * The producer (I2C handler on core 0) only writes head, the consumer
+ * (steppers on core 1) only writes tail.
+*/
+typedef struct keyframe_queue {
+    t_keyframe frames[KEYFRAME_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+} t_keyframe_queue;
+
+/**
+ * Appends a keyframe, producer side only
+ * @param queue     queue
+ * @param frame     keyframe to append
+ * @return false if the queue is full
+*/
+bool keyframe_queue_push(t_keyframe_queue *queue, const t_keyframe *frame);
+
+/**
+ * Removes the oldest keyframe, consumer side only
+ * @param queue     queue
+ * @param frame     filled with the removed keyframe
+ * @return false if the queue is empty
+*/
+bool keyframe_queue_pop(t_keyframe_queue *queue, t_keyframe *frame);
+
+/**
+ * Number of queued keyframes, safe from both sides
+ * @param queue     queue
+ * @return queued keyframes
+*/
+uint32_t keyframe_queue_count(t_keyframe_queue *queue);
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef STEP_GENERATOR_H
+#define STEP_GENERATOR_H
+
+#include <stdint.h>
+#include "clock_state.h"
+
+// Number of step/dir outputs driven by the generator
+#define STEP_GENERATOR_CHANNELS 6
+
+// Intervals buffered per channel, must be a power of two
+#define STEP_RING_SIZE 64
+
+/**
+ * Hardware timed step pulses. Every channel runs a PIO state machine that
+ * emits one pulse per interval word, fed by DMA from a per-channel ring of
+ * intervals. Core 1 only has to keep the rings filled.
+ *
+ * A word emits a step pulse immediately, then holds the next one back for
+ * the given interval. If the ring runs dry the motor just pauses, it never
+ * replays stale intervals.
+*/
+
+typedef struct step_stats
+{
+  uint32_t steps;                         // pulses emitted since boot
+  uint32_t late[STATS_LATENESS_BUCKETS];  // pulses fired late, by lateness
+  uint32_t late_max_us;                   // worst lateness
+} t_step_stats;
+
+/**
+ * Lateness bucket of a late pulse
+ * @param us    lateness
+ * @return bucket index (0 <= index < STATS_LATENESS_BUCKETS)
+*/
+static inline uint8_t step_lateness_bucket(uint32_t us)
+{
+  uint8_t bucket = 0;
+  for (uint32_t limit = 10; bucket < STATS_LATENESS_BUCKETS - 1 && us > limit; limit *= 10)
+    bucket++;
+  return bucket;
+}
+
+/**
+ * Configures a channel, claims its state machine and DMA channel
+ * @param channel     channel index (0 <= channel < STEP_GENERATOR_CHANNELS)
+ * @param step_pin    step output pin
+*/
+void step_generator_begin(uint8_t channel, uint8_t step_pin);
+
+/**
+ * Starts a new move, the channel must be idle
+ * @param channel     channel index
+*/
+void step_generator_reset(uint8_t channel);
+
+/**
+ * Number of intervals that can be pushed without blocking
+ * @param channel     channel index
+ * @return free ring slots
+*/
+uint32_t step_generator_free(uint8_t channel);
+
+/**
+ * Queues one step
+ * @param channel     channel index
+ * @param interval    microseconds to wait after this step before the next one
+*/
+void step_generator_push(uint8_t channel, uint32_t interval);
+
+/**
+ * Hands the pushed intervals to DMA, needs to be called after pushing
+ * and often enough that the state machine FIFO does not drain
+ * @param channel     channel index
+*/
+void step_generator_service(uint8_t channel);
+
+/**
+ * Steps emitted since the last reset, core 1 only: it updates the channel
+ * and is only consistent with step_generator_service() on the same core
+ * @param channel     channel index
+ * @return number of pulses already on the pin
+*/
+uint32_t step_generator_emitted(uint8_t channel);
+
+/**
+ * Pulse timing counters. A pulse is late when the ring ran dry before it,
+ * by how much is measured against the intervals pushed since the move
+ * started. The other core may read them, the step count then lags the pin
+ * by whatever core 1 has not accounted yet, and can count a move twice
+ * while it is being reset.
+ * @param channel       channel index
+ * @param stats         filled with the counters
+ * @param restart_max   start a new worst lateness
+*/
+void step_generator_stats(uint8_t channel, t_step_stats *stats, bool restart_max);
+
+#endif
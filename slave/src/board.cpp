@@ -1,16 +1,31 @@
 #include "board.h"
+#include "step_generator.h"
 
 // Define a stepper and the pins it will use
 ClockAccelStepper _motors[6] = {
-  ClockAccelStepper(ClockAccelStepper::DRIVER, F_STEP, F_DIR), // 0 -> h clock 0
-  ClockAccelStepper(ClockAccelStepper::DRIVER, E_STEP, E_DIR), // 1 -> m clock 0
-  ClockAccelStepper(ClockAccelStepper::DRIVER, D_STEP, D_DIR), // 2 -> h clock 1
-  ClockAccelStepper(ClockAccelStepper::DRIVER, C_STEP, C_DIR), // 3 -> m clock 1
-  ClockAccelStepper(ClockAccelStepper::DRIVER, B_STEP, B_DIR), // 4 -> h clock 2
-  ClockAccelStepper(ClockAccelStepper::DRIVER, A_STEP, A_DIR)  // 5 -> m clock 2
+  ClockAccelStepper(0, F_STEP, F_DIR), // 0 -> h clock 0
+  ClockAccelStepper(1, E_STEP, E_DIR), // 1 -> m clock 0
+  ClockAccelStepper(2, D_STEP, D_DIR), // 2 -> h clock 1
+  ClockAccelStepper(3, C_STEP, C_DIR), // 3 -> m clock 1
+  ClockAccelStepper(4, B_STEP, B_DIR), // 4 -> h clock 2
+  ClockAccelStepper(5, A_STEP, A_DIR)  // 5 -> m clock 2
 };
 
 uint8_t _i2c_address = 0;
+volatile bool _board_ready = false;
+
+/**
+ * Motor state as last seen by core 1, status reads on core 0 take it from
+ * here and never touch the motors or the step generator
+*/
+typedef struct motor_snapshot
+{
+  volatile int32_t position;
+  volatile int32_t distance_to_go;
+  volatile int16_t angle;
+} t_motor_snapshot;
+
+t_motor_snapshot _snapshots[6];
 
 static int sanitize_angle(int angle)
 {
@@ -18,6 +33,22 @@ static int sanitize_angle(int angle)
   return angle < 0 ? 360 + angle : angle;
 }
 
+/**
+ * Publishes the state of a motor for core 0, core 1 only once the board
+ * is ready
+*/
+static void publish_motor(int motor)
+{
+  _snapshots[motor].position = _motors[motor].currentPosition();
+  _snapshots[motor].distance_to_go = _motors[motor].distanceToGo();
+  _snapshots[motor].angle = _motors[motor].currentHandAngle();
+}
+
+static uint16_t saturate_u16(uint32_t value)
+{
+  return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
 void board_begin()
 {
   // Reset motor controllers
@@ -27,11 +58,12 @@ void board_begin()
   // Init motors
   for(int i = 0; i < 6; i++)
   {
+    _motors[i].enableOutputs();
     if(i % 2 == 1)
       _motors[i].setReverse(true);
     _motors[i].setMaxMotorSteps(STEPS);
     _motors[i].setHandAngle(INIT_HANDS_ANGLE);
-    _motors[i].setMinPulseWidth(0);
+    publish_motor(i);
   }
 
   pinMode(ADDR_1, INPUT_PULLUP);
@@ -42,12 +74,21 @@ void board_begin()
                (!digitalRead(ADDR_2) << 1) + 
                (!digitalRead(ADDR_3) << 2) + 
                (!digitalRead(ADDR_4) << 3);
+  _board_ready = true;
+}
+
+bool board_ready()
+{
+  return _board_ready;
 }
 
 void board_loop()
 {
   for(int i = 0; i < 6; i++)
+  {
     _motors[i].run();
+    publish_motor(i);
+  }
 }
 
 uint8_t get_i2c_address()
@@ -64,29 +105,64 @@ bool clock_is_running(int index)
          _motors[index*2 + 1].distanceToGo();
 }
 
+void board_fill_status(t_board_status *status)
+{
+  status->running = 0;
+  for(int i = 0; i < 6; i++)
+  {
+    // Each field is a single word, a read may mix two updates but never
+    // sees a value that was not true at some point
+    long distance = _snapshots[i].distance_to_go;
+    if(distance != 0)
+      status->running |= 1 << (i / 2);
+    status->distance_to_go[i] = constrain(distance, INT16_MIN, INT16_MAX);
+    status->angle[i] = _snapshots[i].angle;
+  }
+}
+
+void board_fill_stats(t_board_stats *stats, bool restart_max)
+{
+  for(int i = 0; i < 6; i++)
+  {
+    // Motors drive the step generator channel of the same index
+    t_step_stats step_stats;
+    step_generator_stats(i, &step_stats, restart_max);
+    stats->steps[i] = step_stats.steps;
+    for(int b = 0; b < STATS_LATENESS_BUCKETS; b++)
+      stats->late[i][b] = saturate_u16(step_stats.late[b]);
+    stats->late_max_us[i] = saturate_u16(step_stats.late_max_us);
+  }
+}
+
 void set_clock(int index, t_clock state)
 {
+  bool scurve = state.flags & CLOCK_FLAG_SCURVE;
+
   int angle_h = sanitize_angle(state.angle_h + state.adjust_h);
   _motors[index*2].setMaxSpeed(state.speed_h);
   _motors[index*2].setAcceleration(state.accel_h);
+  _motors[index*2].setSCurve(scurve);
   _motors[index*2].moveToAngle(angle_h, state.mode_h);
 
   int angle_m = sanitize_angle(state.angle_m + state.adjust_m);
   _motors[index*2 + 1].setMaxSpeed(state.speed_m);
   _motors[index*2 + 1].setAcceleration(state.accel_m);
+  _motors[index*2 + 1].setSCurve(scurve);
   _motors[index*2 + 1].moveToAngle(angle_m, state.mode_m);
+  publish_motor(index*2);
+  publish_motor(index*2 + 1);
 }
 
 void adjust_h_hand(int index, signed char amount)
 {
   int steps = amount * STEPS / 360;
   _motors[index*2 + 1].move(steps);
-  _motors[index*2 + 1].runToPosition();
+  publish_motor(index*2 + 1);
 }
 
 void adjust_m_hand(int index, signed char amount)
 {
   int steps = amount * STEPS / 360;
   _motors[index*2].move(-steps);
-  _motors[index*2].runToPosition();
+  publish_motor(index*2);
 }
\ No newline at end of file
@@ -1,10 +1,291 @@
 #include "clock_accel_stepper.h"
+#include "step_generator.h"
 
-ClockAccelStepper::ClockAccelStepper(uint8_t interface, uint8_t pin1, uint8_t pin2, uint8_t pin3, uint8_t pin4, bool enable)
-    : AccelStepper(interface, pin1, pin2, pin3, pin4, enable)
+// The tail extrapolation shifts (RAMP_TABLE_SIZE - 1) by 24 bits
+static_assert(RAMP_TABLE_SIZE <= 256, "ramp table too large");
+
+typedef struct ramp_table
+{
+  uint16_t ratio[RAMP_TABLE_SIZE];
+} t_ramp_table;
+
+/**
+ * Ratio c_k / c_0 of Austin's recurrence c_k = c_(k-1) - 2 c_(k-1) / (4k + 1),
+ * in Q16. It does not depend on the acceleration, so it is built at compile time.
+ */
+static constexpr t_ramp_table make_ramp_table()
+{
+  t_ramp_table table = {};
+  uint64_t ratio = 0xFFFFFFFFull; // Q32
+  for (uint32_t k = 0; k < RAMP_TABLE_SIZE; k++)
+  {
+    if (k > 0)
+      ratio = ratio * (4 * k - 1) / (4 * k + 1);
+    table.ratio[k] = (uint16_t)(ratio >> 16);
+  }
+  return table;
+}
+
+static constexpr t_ramp_table RAMP = make_ramp_table();
+
+typedef struct scurve_table
+{
+  uint16_t time[SCURVE_TABLE_SIZE];
+} t_scurve_table;
+
+/**
+ * S-curve ramp of duration T to speed V: v(u) = V (3u^2 - 2u^3) with u = t / T,
+ * so the acceleration starts and ends at 0 and the jerk is bounded. It covers
+ * x(u) = V T (u^3 - u^4 / 2) steps. Entry i is u in Q16 at the position
+ * x / (V T / 2) = (i / 256)^3: early in the ramp u grows with the cube root of
+ * the position, indexing by it keeps the first steps accurate.
+ */
+static constexpr t_scurve_table make_scurve_table()
+{
+  t_scurve_table table = {};
+  for (int i = 0; i < SCURVE_TABLE_SIZE; i++)
+  {
+    double q = (double)i / (SCURVE_TABLE_SIZE - 1);
+    double position = q * q * q;
+    // 2u^3 - u^4 is increasing on [0, 1]
+    double low = 0, high = 1;
+    for (int n = 0; n < 40; n++)
+    {
+      double u = (low + high) / 2;
+      if (2 * u * u * u - u * u * u * u < position)
+        low = u;
+      else
+        high = u;
+    }
+    double time = (low + high) / 2 * 65536;
+    table.time[i] = time > 65535 ? 65535 : (uint16_t)time;
+  }
+  return table;
+}
+
+static constexpr t_scurve_table SCURVE = make_scurve_table();
+
+template <typename T>
+static T isqrt(T value)
+{
+  T result = 0;
+  T bit = (T)1 << (sizeof(T) * 8 - 2);
+  while (bit > value)
+    bit >>= 2;
+  while (bit)
+  {
+    if (value >= result + bit)
+    {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    }
+    else
+      result >>= 1;
+    bit >>= 2;
+  }
+  return result;
+}
+
+static uint32_t icbrt(uint64_t value)
+{
+  uint64_t result = 0;
+  for (int shift = 63; shift >= 0; shift -= 3)
+  {
+    result <<= 1;
+    uint64_t bit = 3 * result * (result + 1) + 1;
+    if ((value >> shift) >= bit)
+    {
+      value -= bit << shift;
+      result++;
+    }
+  }
+  return result;
+}
+
+ClockAccelStepper::ClockAccelStepper(uint8_t channel, uint8_t step_pin, uint8_t dir_pin)
 {
   _current_angle = 0;
+  _max_steps = 0;
   _reverse = false;
+
+  _channel = channel;
+  _step_pin = step_pin;
+  _dir_pin = dir_pin;
+
+  _target_pos = 0;
+  _move_start = 0;
+  _move_steps = 0;
+  _steps_queued = 0;
+  _direction = false;
+
+  _max_speed = 0;
+  _acceleration = 0;
+  setMaxSpeed(1);
+  setAcceleration(1);
+
+  _scurve = false;
+  _s_ramp_steps = 0;
+  _s_ramp_time = 0;
+  _s_cmin = 0;
+}
+
+void ClockAccelStepper::enableOutputs()
+{
+  pinMode(_dir_pin, OUTPUT);
+  digitalWrite(_dir_pin, _direction ? HIGH : LOW);
+  step_generator_begin(_channel, _step_pin);
+}
+
+void ClockAccelStepper::setMaxSpeed(uint32_t speed)
+{
+  _max_speed = speed > 0 ? speed : 1;
+  _cmin = 1000000 / _max_speed;
+}
+
+void ClockAccelStepper::setAcceleration(uint32_t acceleration)
+{
+  if (acceleration == 0 || acceleration == _acceleration)
+    return;
+  _acceleration = acceleration;
+  // c0 = 0.676 * sqrt(2 / a) * 10^6, Equation 15 of Austin's paper
+  _c0 = (uint32_t)isqrt<uint64_t>(913952000000ull / acceleration);
+  _c_tail = ((uint64_t)_c0 * RAMP.ratio[RAMP_TABLE_SIZE - 1]) >> 16;
+}
+
+void ClockAccelStepper::setSCurve(bool scurve)
+{
+  _scurve = scurve;
+}
+
+void ClockAccelStepper::move(long relative)
+{
+  moveTo(currentPosition() + relative);
+}
+
+void ClockAccelStepper::moveTo(long absolute)
+{
+  long position = currentPosition();
+  _target_pos = absolute;
+  _move_start = position;
+  _move_steps = absolute > position ? absolute - position : position - absolute;
+  _steps_queued = 0;
+  step_generator_reset(_channel);
+  if (_move_steps == 0)
+    return;
+  if (_scurve)
+    planSCurve();
+
+  bool direction = absolute > position;
+  if (direction != _direction)
+  {
+    // The generator is idle, safe to switch direction before the first pulse
+    _direction = direction;
+    digitalWrite(_dir_pin, _direction ? HIGH : LOW);
+  }
+  run();
+}
+
+uint32_t ClockAccelStepper::rampInterval(uint32_t k)
+{
+  if (k < RAMP_TABLE_SIZE)
+    return ((uint64_t)_c0 * RAMP.ratio[k]) >> 16;
+  // Past the table c_k ~ 1 / sqrt(k), scaled from the last tabled interval (Q12 ratio)
+  uint32_t ratio = isqrt<uint32_t>(((uint32_t)(RAMP_TABLE_SIZE - 1) << 24) / k);
+  return (_c_tail * ratio) >> 12;
+}
+
+void ClockAccelStepper::planSCurve()
+{
+  // Peak acceleration of the ramp is 1.5 V / T, so T = 1.5 V / a and the
+  // ramp covers V T / 2 = 0.75 V^2 / a steps
+  uint32_t speed = _max_speed;
+  uint64_t ramp_steps = (uint64_t)3 * speed * speed / (4 * _acceleration);
+  if (2 * ramp_steps > _move_steps)
+  {
+    // Too short to reach max speed, the ramps meet half way
+    ramp_steps = _move_steps / 2;
+    speed = isqrt<uint64_t>((uint64_t)4 * _acceleration * ramp_steps / 3);
+  }
+  if (ramp_steps == 0)
+    ramp_steps = 1;
+  if (speed == 0)
+    speed = 1;
+
+  _s_ramp_steps = ramp_steps;
+  _s_ramp_time = (uint64_t)3000000 * speed / (2 * _acceleration);
+  _s_cmin = 1000000 / speed;
+  _s_memo_k[0] = _s_memo_k[1] = UINT32_MAX;
+  _s_memo_next = 0;
+}
+
+uint64_t ClockAccelStepper::sCurveTime(uint32_t k)
+{
+  for (int i = 0; i < 2; i++)
+    if (_s_memo_k[i] == k)
+      return _s_memo_t[i];
+
+  uint64_t time = _s_ramp_time;
+  if (k < _s_ramp_steps)
+  {
+    // Cube root of the ramp position in Q14, the table is indexed by its top 8 bits
+    uint32_t q = icbrt(((uint64_t)k << 42) / _s_ramp_steps);
+    uint32_t i = q >> 6;
+    uint32_t u = SCURVE.time[i] + (((SCURVE.time[i + 1] - SCURVE.time[i]) * (q & 63)) >> 6);
+    time = (_s_ramp_time * u) >> 16;
+  }
+
+  _s_memo_k[_s_memo_next] = k;
+  _s_memo_t[_s_memo_next] = time;
+  _s_memo_next ^= 1;
+  return time;
+}
+
+uint32_t ClockAccelStepper::stepInterval(uint32_t step)
+{
+  uint32_t remaining = _move_steps - step;
+  if (remaining == 0)
+    return 0;
+
+  // Accelerate from the start of the move, mirror the ramp when approaching the target
+  uint32_t k = step < remaining ? step : remaining;
+  if (_scurve)
+  {
+    if (k >= _s_ramp_steps)
+      return _s_cmin;
+    // Pulse k + 1 of the ramp is at sCurveTime(k)
+    return sCurveTime(k) - sCurveTime(k - 1);
+  }
+  uint32_t interval = rampInterval(k);
+  return interval > _cmin ? interval : _cmin;
+}
+
+bool ClockAccelStepper::run()
+{
+  uint32_t free = step_generator_free(_channel);
+  while (free-- > 0 && _steps_queued < _move_steps)
+  {
+    _steps_queued++;
+    step_generator_push(_channel, stepInterval(_steps_queued));
+  }
+  step_generator_service(_channel);
+  return distanceToGo() != 0;
+}
+
+void ClockAccelStepper::runToPosition()
+{
+  while (run())
+    ;
+}
+
+long ClockAccelStepper::distanceToGo()
+{
+  return _target_pos - currentPosition();
+}
+
+long ClockAccelStepper::currentPosition()
+{
+  long emitted = step_generator_emitted(_channel);
+  return _direction ? _move_start + emitted : _move_start - emitted;
 }
 
 void ClockAccelStepper::setHandAngle(int angle)
@@ -12,6 +293,19 @@ void ClockAccelStepper::setHandAngle(int angle)
   _current_angle = angle;
 }
 
+int ClockAccelStepper::getHandAngle()
+{
+  return _current_angle;
+}
+
+int ClockAccelStepper::currentHandAngle()
+{
+  // Positive steps turn the hand clockwise, towards lower angles
+  long remaining = distanceToGo() * (_reverse ? -1 : 1);
+  int angle = (_current_angle + remaining * 360 / _max_steps) % 360;
+  return angle < 0 ? angle + 360 : angle;
+}
+
 void ClockAccelStepper::setReverse(bool reverse)
 {
   _reverse = reverse;
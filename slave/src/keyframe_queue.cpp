@@ -0,0 +1,32 @@
+#include "keyframe_queue.h"
+
+bool keyframe_queue_push(t_keyframe_queue *queue, const t_keyframe *frame)
+{
+  uint32_t head = queue->head;
+  uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+  if (head - tail >= KEYFRAME_QUEUE_SIZE)
+    return false;
+
+  queue->frames[head & (KEYFRAME_QUEUE_SIZE - 1)] = *frame;
+  // Publish the slot only once it is completely written
+  __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool keyframe_queue_pop(t_keyframe_queue *queue, t_keyframe *frame)
+{
+  uint32_t tail = queue->tail;
+  uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+  if (head == tail)
+    return false;
+
+  *frame = queue->frames[tail & (KEYFRAME_QUEUE_SIZE - 1)];
+  // Hand the slot back only once it has been copied out
+  __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+uint32_t keyframe_queue_count(t_keyframe_queue *queue)
+{
+  return __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+}
@@ -1,34 +1,365 @@
 #include <Wire.h>
+#include <hardware/i2c.h>
 
 #include "board_config.h"
 #include "board.h"
 #include "clock_state.h"
+#include "crc16.h"
 #include "i2c.h"
+#include "keyframe_queue.h"
 
-const t_clock default_clock = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+// Core 1 loop rate is averaged over this long, us
+#define LOOP1_RATE_WINDOW_US 100000
+
+const t_clock default_clock = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
 // int spin_num; //The spin lock number
 spin_lock_t *spin_lock[3]; //The spinlock object that will be associated with spin_num
 
+// Last target received for each clock, deltas are relative to it. Only touched by core 0
 t_half_digit target_clocks_state;
 t_half_digit current_clocks_state;
 
+// Keyframes waiting to be executed by core 1, one queue per clock
+t_keyframe_queue keyframe_queues[3];
+// Latest keyframe received while its queue was full, guarded by spin_lock
+t_keyframe overflow_frames[3];
+volatile bool overflow_pending[3] = {false, false, false};
+
+// Set by core 1 from taking a keyframe until its move is set up, so a
+// status read never sees a clock with nothing queued that has not started yet
+volatile bool starting[3] = {false, false, false};
+// Counter of the last keyframe each clock started, written by core 1
+volatile uint32_t applied_counters[3] = {0, 0, 0};
+// Core 1 loop iterations per second, worked out by core 1 alone and read
+// by the status and stats blocks
+volatile uint32_t loop1_rate = 0;
+uint32_t loop1_count = 0;
+uint32_t loop1_window_start_us = 0;
+
+// Instrumentation, maxima restart when the stats are read
+volatile uint32_t loop1_max_us = 0;
+uint32_t loop1_last_us = 0;
+volatile uint32_t lock_wait_max_us[2] = {0, 0}; // I2C handler, core 1
+// Block answered by the next read
+volatile uint8_t read_block = READ_STATUS;
+// Pattern of the last echo frame
+uint8_t echo_pattern[I2C_ECHO_SIZE];
+
+// Frame reception, only touched by core 0
+uint8_t rx_seq = 0;
+uint16_t rx_last_crc = 0;
+uint32_t rx_frames = 0;
+uint32_t rx_crc_errors = 0;
+uint32_t rx_length_errors = 0;
+uint32_t rx_duplicates = 0;
+
+// Frames staged for the next commit, only touched by core 0
+t_half_digit staged_clocks_state;
+uint8_t staged_mask = 0;
+uint16_t staged_epoch = 0;
+
+static void record_max(volatile uint32_t &max, uint32_t value)
+{
+  if (value > max)
+    max = value;
+}
+
+/**
+ * Decodes a delta frame payload on top of state.
+ * @return false if the payload is malformed, state is then partially written
+ */
+static bool decode_delta_payload(const uint8_t *payload, size_t len, t_half_digit &state, uint8_t &clock_mask)
+{
+  if (len < 1)
+    return false;
+
+  clock_mask = payload[0];
+  size_t pos = 1;
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (!(clock_mask & (1 << i)))
+      continue;
+
+    uint16_t field_mask;
+    if (pos + sizeof(field_mask) + sizeof(state.change_counter[i]) > len)
+      return false;
+    memcpy(&field_mask, payload + pos, sizeof(field_mask));
+    pos += sizeof(field_mask);
+    memcpy(&state.change_counter[i], payload + pos, sizeof(state.change_counter[i]));
+    pos += sizeof(state.change_counter[i]);
+
+    for (uint8_t f = 0; f < CLOCK_FIELDS_COUNT; f++)
+    {
+      if (!(field_mask & (1 << f)))
+        continue;
+      if (pos + clock_fields[f].size > len)
+        return false;
+      memcpy((uint8_t *)&state.clocks[i] + clock_fields[f].offset, payload + pos, clock_fields[f].size);
+      pos += clock_fields[f].size;
+    }
+  }
+  return true;
+}
+
+/**
+ * Queues the selected clocks of state as keyframes for core 1
+ */
+static void enqueue_clocks(const t_half_digit &state, uint8_t clock_mask)
+{
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (!(clock_mask & (1 << i)))
+      continue;
+    target_clocks_state.clocks[i] = state.clocks[i];
+    target_clocks_state.change_counter[i] = state.change_counter[i];
+
+    t_keyframe frame = {state.clocks[i], state.change_counter[i]};
+    uint32_t wait_start = micros();
+    spin_lock_unsafe_blocking(spin_lock[i]); //Acquire the spin lock without disabling interrupts
+    record_max(lock_wait_max_us[0], micros() - wait_start);
+    // Once a keyframe overflowed, newer ones replace it until core 1 catches up
+    // so they are never executed out of order
+    if (overflow_pending[i] || !keyframe_queue_push(&keyframe_queues[i], &frame))
+    {
+      overflow_frames[i] = frame;
+      overflow_pending[i] = true;
+    }
+    spin_unlock_unsafe(spin_lock[i]); //Release the spin lock without re-enabling interrupts
+  }
+}
+
+/**
+ * Takes the next keyframe of a clock, core 1 only
+ * @return false if there is nothing to execute
+ */
+static bool next_keyframe(uint8_t index, t_keyframe *frame)
+{
+  if (keyframe_queue_pop(&keyframe_queues[index], frame))
+    return true;
+  if (!overflow_pending[index])
+    return false;
+
+  uint32_t wait_start = micros();
+  spin_lock_unsafe_blocking(spin_lock[index]);
+  record_max(lock_wait_max_us[1], micros() - wait_start);
+  *frame = overflow_frames[index];
+  overflow_pending[index] = false;
+  spin_unlock_unsafe(spin_lock[index]);
+  return true;
+}
+
+static void handle_delta_frame(const uint8_t *payload, size_t len)
+{
+  t_half_digit tmp_state = target_clocks_state;
+  uint8_t clock_mask;
+  if (decode_delta_payload(payload, len, tmp_state, clock_mask))
+    enqueue_clocks(tmp_state, clock_mask);
+}
+
+static void handle_stage_frame(const uint8_t *payload, size_t len)
+{
+  uint16_t epoch;
+  if (len < sizeof(epoch))
+    return;
+  memcpy(&epoch, payload, sizeof(epoch));
+
+  // A new epoch drops whatever was staged and never committed
+  if (staged_mask == 0 || epoch != staged_epoch)
+  {
+    staged_clocks_state = target_clocks_state;
+    staged_mask = 0;
+    staged_epoch = epoch;
+  }
+
+  t_half_digit tmp_state = staged_clocks_state;
+  uint8_t clock_mask;
+  if (decode_delta_payload(payload + sizeof(epoch), len - sizeof(epoch), tmp_state, clock_mask))
+  {
+    staged_clocks_state = tmp_state;
+    staged_mask |= clock_mask;
+  }
+}
+
+static void handle_commit_frame(const uint8_t *payload, size_t len)
+{
+  uint16_t epoch;
+  if (len < sizeof(epoch))
+    return;
+  memcpy(&epoch, payload, sizeof(epoch));
+
+  if (staged_mask != 0 && epoch == staged_epoch)
+    enqueue_clocks(staged_clocks_state, staged_mask);
+  staged_mask = 0;
+}
+
 // I2C runs on main core (core 0)
 void receiveEvent(int how_many)
 {
   // Serial.println("Received something");
-  if (how_many >= sizeof(half_digit))
+  uint8_t frame[I2C_MAX_FRAME_SIZE];
+  size_t len = 0;
+  while (Wire.available())
+  {
+    uint8_t value = Wire.read();
+    if (len < sizeof(frame))
+      frame[len++] = value;
+  }
+
+  // An empty write is the master probing the address
+  if (len == 0)
+    return;
+  if (how_many > (int)sizeof(frame) || len < I2C_FRAME_HEADER_SIZE + I2C_FRAME_CRC_SIZE ||
+      frame[0] != I2C_PROTOCOL_VERSION || frame[2] != len)
+  {
+    rx_length_errors++;
+    return;
+  }
+  uint16_t crc;
+  len -= I2C_FRAME_CRC_SIZE;
+  memcpy(&crc, frame + len, sizeof(crc));
+  if (crc16(frame, len) != crc)
   {
-    t_half_digit tmp_state;
-    I2C_readAnything (tmp_state);
+    rx_crc_errors++;
+    return;
+  }
 
-    for (uint8_t i = 0; i < 3; i++)
+  // Commits are broadcast and idempotent, they are not acknowledged
+  if (frame[1] != FRAME_COMMIT)
+  {
+    // The master did not see the first copy arrive and sent it again
+    if (frame[3] == rx_seq && crc == rx_last_crc)
     {
-      spin_lock_unsafe_blocking(spin_lock[i]); //Acquire the spin lock without disabling interrupts
-      target_clocks_state.clocks[i] = tmp_state.clocks[i];
-      target_clocks_state.change_counter[i] = tmp_state.change_counter[i];
-      spin_unlock_unsafe(spin_lock[i]); //Release the spin lock without re-enabling interrupts
+      rx_duplicates++;
+      return;
     }
+    rx_seq = frame[3];
+    rx_last_crc = crc;
+  }
+  rx_frames++;
+
+  const uint8_t *payload = frame + I2C_FRAME_HEADER_SIZE;
+  size_t payload_len = len - I2C_FRAME_HEADER_SIZE;
+  switch (frame[1])
+  {
+    case FRAME_DELTA:
+      handle_delta_frame(payload, payload_len);
+      break;
+    case FRAME_STAGE:
+      handle_stage_frame(payload, payload_len);
+      break;
+    case FRAME_COMMIT:
+      handle_commit_frame(payload, payload_len);
+      break;
+    case FRAME_SELECT:
+      if (payload_len >= 1)
+        read_block = payload[0];
+      break;
+    case FRAME_ECHO:
+      if (payload_len == sizeof(echo_pattern))
+      {
+        memcpy(echo_pattern, payload, sizeof(echo_pattern));
+        read_block = READ_ECHO;
+      }
+      break;
+  }
+}
+
+static void fill_stats(t_board_stats &stats)
+{
+  stats.version = I2C_PROTOCOL_VERSION;
+  stats.rx_seq = rx_seq;
+  stats.rx_frames = rx_frames;
+  stats.rx_crc_errors = rx_crc_errors;
+  stats.rx_length_errors = rx_length_errors;
+  stats.rx_duplicates = rx_duplicates;
+  stats.loop_rate = loop1_rate;
+  stats.loop_max_us = loop1_max_us;
+  loop1_max_us = 0;
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    uint32_t wait = lock_wait_max_us[i];
+    stats.lock_wait_max_us[i] = wait > UINT16_MAX ? UINT16_MAX : wait;
+    lock_wait_max_us[i] = 0;
+  }
+  board_fill_stats(&stats, true);
+}
+
+static void send_stats()
+{
+  t_board_stats stats;
+  fill_stats(stats);
+  Wire.write((const uint8_t *)&stats, sizeof(stats));
+}
+
+static void send_status()
+{
+  t_board_status status;
+  status.version = I2C_PROTOCOL_VERSION;
+  status.rx_seq = rx_seq;
+  status.pending = 0;
+  // Queues first, then the flag core 1 holds while it starts a keyframe,
+  // then the motors: a keyframe taken in between is still seen as running
+  for (uint8_t i = 0; i < 3; i++)
+    if (keyframe_queue_count(&keyframe_queues[i]) > 0 || overflow_pending[i])
+      status.pending |= 1 << i;
+  __dmb();
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (starting[i])
+      status.pending |= 1 << i;
+    status.change_counter[i] = applied_counters[i];
+  }
+  __dmb();
+  board_fill_status(&status);
+  status.loop_rate = loop1_rate;
+
+  Wire.write((const uint8_t *)&status, sizeof(status));
+}
+
+static void send_echo()
+{
+  t_board_echo echo;
+  echo.version = I2C_PROTOCOL_VERSION;
+  echo.rx_seq = rx_seq;
+  memcpy(echo.pattern, echo_pattern, sizeof(echo.pattern));
+  echo.crc = crc16((const uint8_t *)&echo, offsetof(t_board_echo, crc));
+  Wire.write((const uint8_t *)&echo, sizeof(echo));
+}
+
+// Read by the master, runs on core 0
+void requestEvent()
+{
+  uint8_t block = read_block;
+  read_block = READ_STATUS;
+  if (block == READ_STATS)
+    send_stats();
+  else if (block == READ_ECHO)
+    send_echo();
+  else
+    send_status();
+}
+
+/**
+ * Prints the stepping engine instrumentation, maxima restart
+ */
+static void print_stats()
+{
+  t_board_stats stats;
+  fill_stats(stats);
+  Serial.printf("rx: %lu frames, dropped %lu crc, %lu length, %lu duplicates\n",
+    (unsigned long)stats.rx_frames, (unsigned long)stats.rx_crc_errors,
+    (unsigned long)stats.rx_length_errors, (unsigned long)stats.rx_duplicates);
+  Serial.printf("loop1: %lu/s, longest %lu us\n", (unsigned long)stats.loop_rate, (unsigned long)stats.loop_max_us);
+  Serial.printf("lock wait: i2c %u us, core 1 %u us\n", stats.lock_wait_max_us[0], stats.lock_wait_max_us[1]);
+  Serial.println("motor      steps  <=10us <=100us   <=1ms  <=10ms   >10ms   worst");
+  for (uint8_t m = 0; m < 6; m++)
+  {
+    Serial.printf("%5u %10lu", m, (unsigned long)stats.steps[m]);
+    for (uint8_t b = 0; b < STATS_LATENESS_BUCKETS; b++)
+      Serial.printf(" %7u", stats.late[m][b]);
+    Serial.printf(" %7u\n", stats.late_max_us[m]);
   }
 }
 
@@ -47,32 +378,59 @@ void setup()
   }
 
   Wire.begin(get_i2c_address());
+  // Commit frames are broadcast on the general call address
+  i2c0->hw->ic_ack_general_call = 1;
   Wire.onReceive(receiveEvent);
+  Wire.onRequest(requestEvent);
+  Serial.println("Send 's' for stepping stats");
 }
 
 void loop()
 {
+  // 's' on the serial port dumps the instrumentation
+  while (Serial.available())
+    if (Serial.read() == 's')
+      print_stats();
   delay(10);
 }
 
 void setup1() 
 {
   current_clocks_state = {{default_clock, default_clock, default_clock}, {0, 0, 0}};
+  // Step generators are set up by core 0
+  while (!board_ready())
+    delay(1);
+  loop1_last_us = micros();
+  loop1_window_start_us = loop1_last_us;
 }
 
 // Steppers on core 1
 void loop1()
 {
+  uint32_t now = micros();
+  record_max(loop1_max_us, now - loop1_last_us);
+  loop1_last_us = now;
+
   board_loop();
+  loop1_count++;
+  if (now - loop1_window_start_us >= LOOP1_RATE_WINDOW_US)
+  {
+    loop1_rate = (uint64_t)loop1_count * 1000000 / (now - loop1_window_start_us);
+    loop1_count = 0;
+    loop1_window_start_us = now;
+  }
   for (uint8_t i = 0; i < 3; i++)
   {
-    if(!clock_is_running(i) && current_clocks_state.change_counter[i] != target_clocks_state.change_counter[i])
+    t_keyframe frame;
+    if(clock_is_running(i))
+      continue;
+    starting[i] = true;
+    __dmb();
+    if(next_keyframe(i, &frame))
     {
       //Serial.printf("Inside clock %d\n", i);
-      spin_lock_unsafe_blocking(spin_lock[i]);
-      current_clocks_state.clocks[i] = target_clocks_state.clocks[i];
-      current_clocks_state.change_counter[i] = target_clocks_state.change_counter[i];
-      spin_unlock_unsafe(spin_lock[i]);
+      current_clocks_state.clocks[i] = frame.clock;
+      current_clocks_state.change_counter[i] = frame.change_counter;
 
       if(current_clocks_state.clocks[i].mode_h == ADJUST_HAND)
         adjust_h_hand(i, current_clocks_state.clocks[i].adjust_h);
@@ -82,6 +440,9 @@ void loop1()
 
       if(current_clocks_state.clocks[i].mode_h <= MAX_DISTANCE3)
         set_clock(i, current_clocks_state.clocks[i]);
+      applied_counters[i] = frame.change_counter;
     }
+    __dmb();
+    starting[i] = false;
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,181 @@
+#include "step_generator.h"
+
+#include <Arduino.h>
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/pio.h>
+
+#include "clock_step_pio.h"
+
+typedef struct step_channel
+{
+  PIO pio;
+  uint sm;
+  int dma;
+  uint32_t produced;    // intervals written to the ring
+  uint32_t dispatched;  // intervals handed to finished DMA transfers
+  uint32_t in_flight;   // length of the running DMA transfer
+  uint32_t emitted;
+
+  // Pulse timing, all in us
+  uint32_t produced_us;   // intervals written to the ring
+  uint32_t dispatched_us; // intervals handed to finished DMA transfers
+  uint32_t in_flight_us;  // intervals of the running DMA transfer
+  uint32_t start_us;      // time of the first pulse of the move
+  uint32_t late_us;       // lateness accumulated by the move
+  uint32_t past_steps;    // pulses of the previous moves
+  uint32_t late[STATS_LATENESS_BUCKETS];
+  uint32_t late_max_us;
+} t_step_channel;
+
+// Every ring is aligned to its size so DMA can wrap the read address
+static uint32_t _rings[STEP_GENERATOR_CHANNELS][STEP_RING_SIZE] __attribute__((aligned(STEP_RING_SIZE * sizeof(uint32_t))));
+static t_step_channel _channels[STEP_GENERATOR_CHANNELS];
+static int _program_offset[2] = {-1, -1};
+
+// Ring size in bytes as a power of two, for the DMA ring configuration
+static uint ring_size_bits()
+{
+  uint bits = 0;
+  while ((1u << bits) < STEP_RING_SIZE * sizeof(uint32_t))
+    bits++;
+  return bits;
+}
+
+// Intervals read by DMA so far
+static uint32_t transferred(t_step_channel *ch)
+{
+  uint32_t remaining = ch->in_flight ? dma_channel_hw_addr(ch->dma)->transfer_count : 0;
+  return ch->dispatched + ch->in_flight - remaining;
+}
+
+void step_generator_begin(uint8_t channel, uint8_t step_pin)
+{
+  t_step_channel *ch = &_channels[channel];
+  // Four state machines per PIO block, two blocks for six motors
+  uint pio_index = channel / 4;
+  ch->pio = pio_index == 0 ? pio0 : pio1;
+  ch->sm = channel % 4;
+  pio_sm_claim(ch->pio, ch->sm);
+
+  if (_program_offset[pio_index] < 0)
+    _program_offset[pio_index] = pio_add_program(ch->pio, &clock_step_program);
+  uint offset = _program_offset[pio_index];
+
+  pio_gpio_init(ch->pio, step_pin);
+  pio_sm_set_consecutive_pindirs(ch->pio, ch->sm, step_pin, 1, true);
+  pio_sm_config c = clock_step_program_get_default_config(offset);
+  sm_config_set_sideset_pins(&c, step_pin);
+  sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+  sm_config_set_clkdiv(&c, clock_get_hz(clk_sys) / 1000000.0f);
+  pio_sm_init(ch->pio, ch->sm, offset, &c);
+  pio_sm_set_enabled(ch->pio, ch->sm, true);
+
+  ch->dma = dma_claim_unused_channel(true);
+  dma_channel_config dc = dma_channel_get_default_config(ch->dma);
+  channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+  channel_config_set_read_increment(&dc, true);
+  channel_config_set_write_increment(&dc, false);
+  channel_config_set_ring(&dc, false, ring_size_bits());
+  channel_config_set_dreq(&dc, pio_get_dreq(ch->pio, ch->sm, true));
+  dma_channel_configure(ch->dma, &dc, &ch->pio->txf[ch->sm], _rings[channel], 0, false);
+
+  step_generator_reset(channel);
+}
+
+void step_generator_reset(uint8_t channel)
+{
+  t_step_channel *ch = &_channels[channel];
+  ch->produced = 0;
+  ch->dispatched = 0;
+  ch->past_steps += ch->emitted;
+  ch->in_flight = 0;
+  ch->emitted = 0;
+  ch->produced_us = 0;
+  ch->dispatched_us = 0;
+  ch->in_flight_us = 0;
+  ch->late_us = 0;
+}
+
+uint32_t step_generator_free(uint8_t channel)
+{
+  t_step_channel *ch = &_channels[channel];
+  return STEP_RING_SIZE - (ch->produced - transferred(ch));
+}
+
+void step_generator_push(uint8_t channel, uint32_t interval)
+{
+  t_step_channel *ch = &_channels[channel];
+  uint32_t cycles = interval > CLOCK_STEP_OVERHEAD ? interval - CLOCK_STEP_OVERHEAD : 0;
+  _rings[channel][ch->produced & (STEP_RING_SIZE - 1)] = cycles;
+  ch->produced++;
+  ch->produced_us += interval;
+}
+
+/**
+ * Accounts the pulse starting a DMA transfer, it is late if the state
+ * machine stalled waiting for it
+*/
+static void account_pulse(t_step_channel *ch)
+{
+  uint32_t stall_mask = 1u << (PIO_FDEBUG_TXSTALL_LSB + ch->sm);
+  bool stalled = ch->pio->fdebug & stall_mask;
+  ch->pio->fdebug = stall_mask;
+  uint32_t now = micros();
+
+  if (ch->dispatched == 0)
+  {
+    // First pulse of the move, it sets the schedule
+    ch->start_us = now;
+    return;
+  }
+  if (!stalled)
+    return;
+
+  int32_t late = now - (ch->start_us + ch->dispatched_us + ch->late_us);
+  if (late < 0)
+    late = 0;
+  ch->late_us += late;
+  ch->late[step_lateness_bucket(late)]++;
+  if ((uint32_t)late > ch->late_max_us)
+    ch->late_max_us = late;
+}
+
+void step_generator_service(uint8_t channel)
+{
+  t_step_channel *ch = &_channels[channel];
+  if (dma_channel_is_busy(ch->dma))
+    return;
+
+  // Only intervals already written are ever handed to DMA
+  ch->dispatched += ch->in_flight;
+  ch->dispatched_us += ch->in_flight_us;
+  ch->in_flight = ch->produced - ch->dispatched;
+  ch->in_flight_us = ch->produced_us - ch->dispatched_us;
+  if (ch->in_flight == 0)
+    return;
+  account_pulse(ch);
+  dma_channel_set_read_addr(ch->dma, &_rings[channel][ch->dispatched & (STEP_RING_SIZE - 1)], false);
+  dma_channel_set_trans_count(ch->dma, ch->in_flight, true);
+}
+
+uint32_t step_generator_emitted(uint8_t channel)
+{
+  t_step_channel *ch = &_channels[channel];
+  // Words still in the FIFO have not been pulled by the state machine yet
+  uint32_t pulled = transferred(ch) - pio_sm_get_tx_fifo_level(ch->pio, ch->sm);
+  if ((int32_t)(pulled - ch->emitted) > 0)
+    ch->emitted = pulled;
+  return ch->emitted;
+}
+
+void step_generator_stats(uint8_t channel, t_step_stats *stats, bool restart_max)
+{
+  t_step_channel *ch = &_channels[channel];
+  stats->steps = ch->past_steps + ch->emitted;
+  for (uint8_t i = 0; i < STATS_LATENESS_BUCKETS; i++)
+    stats->late[i] = ch->late[i];
+  stats->late_max_us = ch->late_max_us;
+  if (restart_max)
+    ch->late_max_us = 0;
+}